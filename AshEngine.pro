@@ -1,4 +1,4 @@
-QT += core gui network opengl
+QT += core gui network opengl concurrent
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -56,20 +56,31 @@ HEADERS += \
     include/Core/AbstractGizmo.h \
     include/Core/AbstractLight.h \
     include/Core/AmbientLight.h \
+    include/Core/BVH.h \
     include/Core/Camera.h \
     include/Core/Common.h \
     include/Core/DirectionalLight.h \
     include/Core/extmath.h \
+    include/Core/FrustumCuller.h \
     include/Core/Gridline.h \
+    include/Core/ImportCache.h \
+    include/Core/MappedIOSystem.h \
     include/Core/Material.h \
     include/Core/Mesh.h \
+    include/Core/MeshBVH.h \
+    include/Core/Meshlet.h \
+    include/Core/MeshOptimizer.h \
+    include/Core/MeshSimplifier.h \
     include/Core/Model.h \
     include/Core/ModelExporter.h \
     include/Core/ModelLoader.h \
+    include/Core/NativeModelReader.h \
     include/Core/PointLight.h \
+    include/Core/Primitive.h \
     include/Core/RotateGizmo.h \
     include/Core/ScaleGizmo.h \
     include/Core/Scene.h \
+    include/Core/SceneBVH.h \
     include/Core/SceneLoader.h \
     include/Core/SceneSaver.h \
     include/Core/SpotLight.h \
@@ -78,7 +89,10 @@ HEADERS += \
     include/Core/TransformGizmo.h \
     include/Core/TranslateGizmo.h \
     include/Core/Vertex.h \
+    include/Core/VertexLayout.h \
+    include/Core/VertexStreams.h \
     include/OpenGL/FPSCounter.h \
+    include/OpenGL/OpenGLGeometry.h \
     include/OpenGL/OpenGLMaterial.h \
     include/OpenGL/OpenGLMesh.h \
     include/OpenGL/OpenGLRenderer.h \
@@ -107,19 +121,30 @@ SOURCES += \
     src/Core/AbstractGizmo.cpp \
     src/Core/AbstractLight.cpp \
     src/Core/AmbientLight.cpp \
+    src/Core/BVH.cpp \
     src/Core/Camera.cpp \
     src/Core/DirectionalLight.cpp \
     src/Core/extmath.cpp \
+    src/Core/FrustumCuller.cpp \
     src/Core/Gridline.cpp \
+    src/Core/ImportCache.cpp \
+    src/Core/MappedIOSystem.cpp \
     src/Core/Material.cpp \
     src/Core/Mesh.cpp \
+    src/Core/MeshBVH.cpp \
+    src/Core/Meshlet.cpp \
+    src/Core/MeshOptimizer.cpp \
+    src/Core/MeshSimplifier.cpp \
     src/Core/Model.cpp \
     src/Core/ModelExporter.cpp \
     src/Core/ModelLoader.cpp \
+    src/Core/NativeModelReader.cpp \
     src/Core/PointLight.cpp \
+    src/Core/Primitive.cpp \
     src/Core/RotateGizmo.cpp \
     src/Core/ScaleGizmo.cpp \
     src/Core/Scene.cpp \
+    src/Core/SceneBVH.cpp \
     src/Core/SceneLoader.cpp \
     src/Core/SceneSaver.cpp \
     src/Core/SpotLight.cpp \
@@ -128,7 +153,10 @@ SOURCES += \
     src/Core/TransformGizmo.cpp \
     src/Core/TranslateGizmo.cpp \
     src/Core/Vertex.cpp \
+    src/Core/VertexLayout.cpp \
+    src/Core/VertexStreams.cpp \
     src/OpenGL/FPSCounter.cpp \
+    src/OpenGL/OpenGLGeometry.cpp \
     src/OpenGL/OpenGLMaterial.cpp \
     src/OpenGL/OpenGLMesh.cpp \
     src/OpenGL/OpenGLRenderer.cpp \
@@ -0,0 +1,47 @@
+QT += core gui network opengl concurrent
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+TARGET = AshBenchmark
+TEMPLATE = app
+DESTDIR = ../build/bin
+
+CONFIG += console warn_on
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += \
+    $$PWD \
+    ../include/Core \
+    ../3rdparty
+
+macx {
+    LIBS += -L$$PWD/../lib/mac/ -lassimp
+}
+
+win32 {
+    LIBS += -lopengl32
+    LIBS += -L$$PWD/../lib/win/ -lassimp-vc140-mt
+}
+
+linux {
+    LIBS += -L$$PWD/../lib/linux/ -lassimp
+}
+
+MOC_DIR = ../build/tmp/benchmark
+OBJECTS_DIR = ../build/tmp/benchmark
+
+# The benchmarks drive the engine core directly, without a window or a GL context
+HEADERS += \
+    Benchmark.h \
+    $$files(../include/Core/*.h)
+
+SOURCES += \
+    Benchmark.cpp \
+    ImportBenchmark.cpp \
+    main.cpp \
+    StorageBenchmark.cpp \
+    TransformBenchmark.cpp \
+    VertexBenchmark.cpp \
+    $$files(../src/Core/*.cpp)
@@ -0,0 +1,12 @@
+#include <Benchmark.h>
+
+volatile float benchmarkSink = 0;
+
+void printHeader(QString title) {
+    printf("\n%s\n", title.toLocal8Bit().constData());
+}
+
+void printResult(QString name, double milliseconds, QString note) {
+    printf("  %-44s %12.3f ms  %s\n", name.toLocal8Bit().constData(), milliseconds, note.toLocal8Bit().constData());
+    fflush(stdout);
+}
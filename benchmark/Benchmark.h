@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Common.h>
+
+// Written by the benchmarks so that the measured work can't be optimized away
+extern volatile float benchmarkSink;
+
+// Fastest of `runs` calls to task(), in milliseconds
+template <typename Task>
+double bestTime(Task& task, int runs = 5) {
+    double best = inf;
+    for (int i = 0; i < runs; i++) {
+        QElapsedTimer timer;
+        timer.start();
+        task();
+        best = qMin(best, timer.nsecsElapsed() / 1e6);
+    }
+    return best;
+}
+
+void printHeader(QString title);
+void printResult(QString name, double milliseconds, QString note = "");
+
+// Each benchmark takes the command line arguments that follow its name
+void benchmarkTransformCache(const QStringList& args);
+void benchmarkVertexTransform(const QStringList& args);
+void benchmarkVertexStorage(const QStringList& args);
+void benchmarkImport(const QStringList& args);
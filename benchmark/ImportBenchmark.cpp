@@ -0,0 +1,111 @@
+#include <Benchmark.h>
+#include <ImportCache.h>
+#include <ModelLoader.h>
+
+// A binary STL file of `count` triangles on a wavy grid, written in blocks so
+// files of several GB don't have to fit in memory
+static bool generateStl(QString filePath, qint64 count) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+
+    QByteArray header(80, ' ');
+    header.replace(0, 17, "AshBenchmark mesh");
+    quint32 triangleCount = quint32(count);
+    file.write(header);
+    file.write(reinterpret_cast<const char*>(&triangleCount), 4);
+
+    const int side = 4096, blockSize = 1 << 16;
+    QByteArray block;
+    for (qint64 first = 0; first < count; first += blockSize) {
+        int n = int(qMin(qint64(blockSize), count - first));
+        block.resize(n * 50);
+        uchar* record = reinterpret_cast<uchar*>(block.data());
+        for (int i = 0; i < n; i++, record += 50) {
+            qint64 t = first + i;
+            float x = float((t / 2) % side), z = float((t / 2) / side);
+            QVector3D a(x, sinf(x * 0.1f) * cosf(z * 0.1f), z);
+            QVector3D corners[3] = { a, a + QVector3D(0, 0, 1), a + QVector3D(1, 0, t % 2 ? 1 : 0) };
+            QVector3D normal(0, 0, 0); // left to the reader
+            memcpy(record, &normal, 12);
+            memcpy(record + 12, corners, 36);
+            memset(record + 48, 0, 2);
+        }
+        if (file.write(block) != block.size())
+            return false;
+    }
+    return true;
+}
+
+static int triangleCount(const Model* model) {
+    int count = 0;
+    for (int i = 0; i < model->childMeshes().size(); i++)
+        count += model->childMeshes()[i]->indices().size() / 3;
+    for (int i = 0; i < model->childModels().size(); i++)
+        count += triangleCount(model->childModels()[i]);
+    return count;
+}
+
+// Times one import of `filePath`, with or without the native readers
+static void timeImport(QString filePath, bool nativeReaders) {
+    const char* path = nativeReaders ? "native" : "Assimp";
+    ModelLoader loader;
+    loader.setEnableNativeReaders(nativeReaders);
+
+    QElapsedTimer timer;
+    timer.start();
+    Model* model = loader.loadModelFromFile(filePath);
+    double milliseconds = timer.nsecsElapsed() / 1e6;
+    ModelLoader::ImportTimings timings = loader.lastImportTimings();
+
+    if (!model) {
+        printResult(QString("%1, failed").arg(path), milliseconds, loader.errorLog().simplified());
+        return;
+    }
+    QString note = QString("%1 meshes, %2 triangles").arg(model->childMeshes().size()).arg(triangleCount(model));
+    if (!timings.fallbackReason.isEmpty())
+        note += QString(", read by Assimp: %1").arg(timings.fallbackReason);
+    printResult(QString("%1, total").arg(path), milliseconds, note);
+    printResult(QString("%1, read").arg(path), double(timings.read));
+    printResult(QString("%1, post-processing").arg(path), double(timings.postProcess));
+    printResult(QString("%1, conversion").arg(path), double(timings.convert));
+    printResult(QString("%1, assembly").arg(path), double(timings.assemble));
+    delete model;
+}
+
+void benchmarkImport(const QStringList& args) {
+    QString filePath;
+    if (args.size() == 3 && args[0] == "--generate") {
+        qint64 count = args[1].toLongLong();
+        if (count <= 0 || count > 0xffffffffLL) return;
+        filePath = args[2];
+        QElapsedTimer timer;
+        timer.start();
+        if (!generateStl(filePath, count)) {
+            printf("Failed to write %s\n", filePath.toLocal8Bit().constData());
+            return;
+        }
+        printHeader(QString("Generated %1 (%2 MB)").arg(filePath).arg(QFileInfo(filePath).size() >> 20));
+        printResult("write", timer.nsecsElapsed() / 1e6);
+    } else if (args.size() == 1) {
+        filePath = args[0];
+    } else {
+        printHeader("Import: skipped, takes a model file or --generate triangles file");
+        return;
+    }
+    if (!QFileInfo(filePath).isFile()) {
+        printf("No such file %s\n", filePath.toLocal8Bit().constData());
+        return;
+    }
+
+    // Every import reads the file, none is answered from the cache
+    bool cacheEnabled = ImportCache::instance()->enabled();
+    ImportCache::instance()->setEnabled(false);
+
+    printHeader(QString("Import of %1 (%2 MB), native readers and Assimp")
+                .arg(QFileInfo(filePath).fileName()).arg(QFileInfo(filePath).size() >> 20));
+    timeImport(filePath, true);
+    timeImport(filePath, false);
+
+    ImportCache::instance()->setEnabled(cacheEnabled);
+}
@@ -0,0 +1,117 @@
+#include <Benchmark.h>
+#include <Mesh.h>
+#include <MeshBVH.h>
+
+// A wavy grid of about `count` vertices, two triangles per cell
+static Mesh* buildGrid(int count) {
+    int side = qMax(2, int(sqrt(double(count))));
+    QVector<Vertex> vertices(side * side);
+    QVector<uint32_t> indices;
+    indices.reserve((side - 1) * (side - 1) * 6);
+    for (int y = 0; y < side; y++)
+        for (int x = 0; x < side; x++) {
+            QVector3D p(x, sinf(x * 0.1f) * cosf(y * 0.1f) * 4.0f, y);
+            vertices[y * side + x] = Vertex(p, QVector3D(0, 1, 0), QVector3D(1, 0, 0), QVector3D(0, 0, 1),
+                                            QVector2D(float(x) / side, float(y) / side));
+        }
+    for (int y = 0; y + 1 < side; y++)
+        for (int x = 0; x + 1 < side; x++) {
+            uint32_t i = uint32_t(y * side + x);
+            indices << i << i + side << i + 1 << i + 1 << i + side << i + side + 1;
+        }
+
+    Mesh* mesh = new Mesh(Mesh::Triangle);
+    mesh->setGeometry(vertices, indices);
+    return mesh;
+}
+
+// A pass that reads the positions only
+struct BoundsScan {
+    const Mesh* mesh;
+
+    void operator()() {
+        AttributeView<QVector3D> positions = mesh->attributes().positions;
+        AABB box;
+        for (int i = 0; i < positions.size(); i++)
+            box.merge(positions[i]);
+        benchmarkSink = box.maximum.y();
+    }
+};
+
+// Integrated on every call under the non-uniform scale set up below
+struct MassIntegration {
+    const Mesh* mesh;
+
+    void operator()() {
+        benchmarkSink = mesh->mass();
+    }
+};
+
+// A pass that writes a single attribute, run twice to leave the mesh as it was
+struct ReverseNormals {
+    Mesh* mesh;
+
+    void operator()() {
+        mesh->reverseNormals();
+        mesh->reverseNormals();
+        benchmarkSink = mesh->attributes().normals[0].y();
+    }
+};
+
+// A pass that reads every attribute
+struct MergeMeshes {
+    const Mesh* mesh;
+
+    void operator()() {
+        Mesh* merged = Mesh::merge(mesh, mesh);
+        benchmarkSink = float(merged->vertexCount());
+        delete merged;
+    }
+};
+
+struct BuildBVH {
+    const Mesh* mesh;
+
+    void operator()() {
+        MeshBVH bvh(mesh->attributes(), mesh->indices());
+        benchmarkSink = float(bvh.triangleCount());
+    }
+};
+
+void benchmarkVertexStorage(const QStringList& args) {
+    int count = args.size() > 0 ? args[0].toInt() : 1000000;
+    if (count <= 0) return;
+
+    Mesh* meshes[2];
+    meshes[0] = buildGrid(count);
+    meshes[0]->setScaling(QVector3D(1, 2, 3));
+    meshes[1] = new Mesh(*meshes[0]);
+    meshes[1]->setStorageMode(Mesh::Separate);
+
+    printHeader(QString("Core passes over %1 vertices, interleaved and separate storage").arg(meshes[0]->vertexCount()));
+
+    const char* names[] = { "interleaved", "separate" };
+    for (int i = 0; i < 2; i++) {
+        BoundsScan bounds = { meshes[i] };
+        printResult(QString("bounding box, %1").arg(names[i]), bestTime(bounds));
+    }
+    for (int i = 0; i < 2; i++) {
+        MassIntegration mass = { meshes[i] };
+        printResult(QString("mass integration, %1").arg(names[i]), bestTime(mass));
+    }
+    for (int i = 0; i < 2; i++) {
+        ReverseNormals reverse = { meshes[i] };
+        printResult(QString("reverse normals twice, %1").arg(names[i]), bestTime(reverse));
+    }
+    for (int i = 0; i < 2; i++) {
+        MergeMeshes merge = { meshes[i] };
+        printResult(QString("merge with itself, %1").arg(names[i]), bestTime(merge));
+    }
+    for (int i = 0; i < 2; i++) {
+        BuildBVH bvh = { meshes[i] };
+        printResult(QString("triangle BVH build, %1").arg(names[i]), bestTime(bvh, 3));
+    }
+
+    delete meshes[0];
+    delete meshes[1];
+}
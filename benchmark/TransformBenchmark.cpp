@@ -0,0 +1,98 @@
+#include <Benchmark.h>
+#include <Model.h>
+
+// Nested models with `fanout` children per level, the meshes spread over all of them
+static void buildTree(Model* model, int depth, int fanout, int meshesPerModel) {
+    for (int i = 0; i < meshesPerModel; i++) {
+        Mesh* mesh = new Mesh(Mesh::Triangle);
+        mesh->setPosition(QVector3D(i, 0, 0));
+        mesh->setRotation(QVector3D(0, i * 10.0f, 0));
+        model->addChildMesh(mesh);
+    }
+    if (depth == 0) return;
+    for (int i = 0; i < fanout; i++) {
+        Model* child = new Model;
+        child->setPosition(QVector3D(0, i, 0));
+        child->setRotation(QVector3D(i * 5.0f, 0, 0));
+        child->setScaling(QVector3D(1.1f, 1.1f, 1.1f));
+        model->addChildModel(child);
+        buildTree(child, depth - 1, fanout, meshesPerModel);
+    }
+}
+
+// The transform as it was computed before entities cached it
+static QMatrix4x4 uncachedGlobalModelMatrix(const AbstractEntity* entity) {
+    QMatrix4x4 model;
+    model.translate(entity->position());
+    model.rotate(QQuaternion::fromEulerAngles(entity->rotation()));
+    model.scale(entity->scaling());
+    if (AbstractEntity* par = qobject_cast<AbstractEntity*>(entity->parent()))
+        return uncachedGlobalModelMatrix(par) * model;
+    return model;
+}
+
+// What the renderer asks every mesh for once per frame
+struct UncachedFrame {
+    const QVector<const Mesh*>& meshes;
+
+    void operator()() {
+        float sum = 0;
+        for (int i = 0; i < meshes.size(); i++) {
+            QMatrix4x4 modelMat = uncachedGlobalModelMatrix(meshes[i]);
+            sum += modelMat(0, 3) + modelMat.normalMatrix()(0, 0);
+        }
+        benchmarkSink = sum;
+    }
+};
+
+struct CachedFrame {
+    const QVector<const Mesh*>& meshes;
+    AbstractEntity* moved; // moved before every frame if not null
+    int frame;
+
+    void operator()() {
+        if (moved)
+            moved->setPosition(QVector3D(0, frame++ % 2, 0));
+        float sum = 0;
+        for (int i = 0; i < meshes.size(); i++)
+            sum += meshes[i]->globalModelMatrix()(0, 3) + meshes[i]->globalNormalMatrix()(0, 0);
+        benchmarkSink = sum;
+    }
+};
+
+void benchmarkTransformCache(const QStringList& args) {
+    int meshCount = args.size() > 0 ? args[0].toInt() : 50000;
+    const int depth = 5, fanout = 4;
+    int modelCount = 0;
+    for (int level = 0, n = 1; level <= depth; level++, n *= fanout)
+        modelCount += n;
+
+    Model* root = new Model;
+    buildTree(root, depth, fanout, qMax(1, (meshCount + modelCount - 1) / modelCount));
+    QVector<const Mesh*> meshes;
+    root->collectMeshes(meshes);
+
+    // The deepest model that was created last
+    Model* leaf = root;
+    while (leaf->childModels().size())
+        leaf = leaf->childModels().back();
+
+    printHeader(QString("Per-frame transform cost, %1 meshes in %2 models nested %3 levels deep")
+                .arg(meshes.size()).arg(modelCount).arg(depth + 1));
+
+    UncachedFrame uncached = { meshes };
+    printResult("uncached, recomputed up the tree", bestTime(uncached));
+
+    CachedFrame still = { meshes, 0, 0 };
+    still(); // fill the caches
+    printResult("cached, nothing moved", bestTime(still));
+
+    CachedFrame leafMoved = { meshes, leaf, 0 };
+    printResult("cached, one leaf model moved", bestTime(leafMoved),
+                QString("%1 meshes invalidated").arg(leaf->childMeshes().size()));
+
+    CachedFrame rootMoved = { meshes, root, 0 };
+    printResult("cached, root moved", bestTime(rootMoved), "every mesh invalidated");
+
+    delete root;
+}
@@ -0,0 +1,80 @@
+#include <Benchmark.h>
+#include <Vertex.h>
+
+// The per-vertex operator as it was before the batch kernels
+static Vertex transformVertex(QMatrix4x4 mat, const Vertex& vertex) {
+    Vertex t = vertex;
+    t.position = mat * t.position;
+    t.tangent = mat * t.tangent;
+    t.bitangent = mat * t.bitangent;
+    t.normal = QMatrix4x4(mat.normalMatrix()) * t.normal;
+    return t;
+}
+
+struct PerVertexTransform {
+    const QMatrix4x4& mat;
+    const QVector<Vertex>& src;
+    QVector<Vertex>& dst;
+
+    void operator()() {
+        for (int i = 0; i < src.size(); i++)
+            dst[i] = transformVertex(mat, src[i]);
+        benchmarkSink = dst[dst.size() / 2].position.x();
+    }
+};
+
+struct BatchTransform {
+    TransformKernel kernel;
+    const QMatrix4x4& mat;
+    const QVector<Vertex>& src;
+    QVector<Vertex>& dst;
+
+    void operator()() {
+        transformVertices(kernel, mat, src.constData(), dst.data(), src.size());
+        benchmarkSink = dst[dst.size() / 2].position.x();
+    }
+};
+
+static float maxDifference(const QVector<Vertex>& a, const QVector<Vertex>& b) {
+    float difference = 0;
+    for (int i = 0; i < a.size(); i++) {
+        difference = qMax(difference, (a[i].position - b[i].position).length());
+        difference = qMax(difference, (a[i].normal - b[i].normal).length());
+        difference = qMax(difference, (a[i].tangent - b[i].tangent).length());
+        difference = qMax(difference, (a[i].bitangent - b[i].bitangent).length());
+    }
+    return difference;
+}
+
+void benchmarkVertexTransform(const QStringList& args) {
+    int count = args.size() > 0 ? args[0].toInt() : 1000000;
+    if (count <= 0) return;
+
+    QVector<Vertex> src(count), dst(count), reference(count);
+    for (int i = 0; i < count; i++) {
+        qint64 k = i;
+        QVector3D p(k * 7919 % 1000, k * 104729 % 1000, k * 1299709 % 1000 + 1);
+        src[i] = Vertex(p / 100.0f, p.normalized(), QVector3D(1, 0, 0), QVector3D(0, 1, 0), QVector2D(p.x(), p.y()));
+    }
+
+    QMatrix4x4 mat;
+    mat.translate(1, 2, 3);
+    mat.rotate(30, 1, 1, 0);
+    mat.scale(2, 0.5f, 1);
+
+    printHeader(QString("Transform %1 vertices by one matrix").arg(count));
+
+    PerVertexTransform perVertex = { mat, src, reference };
+    printResult("per-vertex operator, before the kernels", bestTime(perVertex));
+
+    const char* names[] = { "scalar kernel", "SSE2 kernel", "AVX kernel" };
+    for (int kernel = ScalarKernel; kernel <= AvxKernel; kernel++) {
+        if (!transformKernelSupported(TransformKernel(kernel))) {
+            printResult(names[kernel], 0, "not supported");
+            continue;
+        }
+        BatchTransform batch = { TransformKernel(kernel), mat, src, dst };
+        double time = bestTime(batch);
+        printResult(names[kernel], time, QString("max difference %1").arg(maxDifference(dst, reference)));
+    }
+}
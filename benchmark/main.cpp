@@ -0,0 +1,47 @@
+#include <Benchmark.h>
+
+int log_level = LOG_LEVEL_WARNING;
+
+struct BenchmarkEntry {
+    const char* name;
+    const char* usage;
+    void (*run)(const QStringList& args);
+};
+
+static const BenchmarkEntry benchmarks[] = {
+    { "transform", "transform [meshes]", benchmarkTransformCache },
+    { "vertices", "vertices [count]", benchmarkVertexTransform },
+    { "storage", "storage [vertices]", benchmarkVertexStorage },
+    { "import", "import [file | --generate triangles file]", benchmarkImport },
+};
+
+static const int benchmarkCount = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+static void printUsage() {
+    printf("Usage: AshBenchmark [benchmark [arguments]]\n");
+    printf("Runs every benchmark with its defaults if none is named:\n");
+    for (int i = 0; i < benchmarkCount; i++)
+        printf("  %s\n", benchmarks[i].usage);
+}
+
+int main(int argc, char *argv[]) {
+    QCoreApplication a(argc, argv);
+
+    QStringList args = a.arguments();
+    args.removeFirst();
+
+    if (args.isEmpty()) {
+        for (int i = 0; i < benchmarkCount; i++)
+            benchmarks[i].run(QStringList());
+        return 0;
+    }
+
+    for (int i = 0; i < benchmarkCount; i++)
+        if (args[0] == benchmarks[i].name) {
+            benchmarks[i].run(args.mid(1));
+            return 0;
+        }
+
+    printUsage();
+    return 1;
+}
@@ -1,67 +1,96 @@
-#pragma once
-
-#include <Common.h>
-
-class AbstractEntity: public QObject {
-    Q_OBJECT
-
-public:
-    AbstractEntity(QObject * parent = 0);
-    AbstractEntity(const AbstractEntity& abstractObject3D);
-    ~AbstractEntity();
-
-    virtual void translate(QVector3D delta);
-    virtual void rotate(QQuaternion rotation);
-    virtual void rotate(QVector3D rotation);
-    virtual void scale(QVector3D scaling);
-
-    virtual void dumpObjectInfo(int level = 0) = 0;
-    virtual void dumpObjectTree(int level = 0) = 0;
-
-    bool visible() const;
-    bool highlighted() const;
-    bool selected() const;
-    bool wireFrameMode() const;
-
-    virtual bool isGizmo() const = 0;
-    virtual bool isLight() const = 0;
-    virtual bool isMesh() const = 0;
-    virtual bool isModel() const = 0;
-
-    virtual QVector3D position() const;
-    virtual QVector3D rotation() const;
-    virtual QVector3D scaling() const;
-
-    virtual QMatrix4x4 localModelMatrix() const;
-    virtual QMatrix4x4 globalModelMatrix() const;
-
-    static AbstractEntity* getHighlighted();
-    static AbstractEntity* getSelected();
-
-public slots:
-    void setVisible(bool visible);
-    void setHighlighted(bool highlighted);
-    void setSelected(bool selected);
-    void setWireFrameMode(bool enabled);
-
-    virtual void setPosition(QVector3D position);
-    virtual void setRotation(QQuaternion rotation);
-    virtual void setRotation(QVector3D rotation);
-    virtual void setScaling(QVector3D scaling);
-
-signals:
-    void visibleChanged(bool visible);
-    void highlightedChanged(bool highlighted);
-    void selectedChanged(bool selected);
-    void wireFrameModeChanged(bool enabled);
-
-    void positionChanged(QVector3D position);
-    void rotationChanged(QVector3D rotation);
-    void scalingChanged(QVector3D scaling);
-
-protected:
-    bool m_visible, m_highlighted, m_selected, m_wireFrameMode;
-    QVector3D m_position, m_rotation, m_scaling;
-
-    static AbstractEntity *m_highlightedObject, *m_selectedObject;
-};
+#pragma once
+
+#include <Common.h>
+
+class AbstractEntity: public QObject {
+    Q_OBJECT
+
+public:
+    enum EffectiveFlag {
+        Visible = 0x01,
+        Highlighted = 0x02,
+        Selected = 0x04,
+        WireFrame = 0x08
+    };
+
+    AbstractEntity(QObject * parent = 0);
+    AbstractEntity(const AbstractEntity& abstractObject3D);
+    ~AbstractEntity();
+
+    virtual void translate(QVector3D delta);
+    virtual void rotate(QQuaternion rotation);
+    virtual void rotate(QVector3D rotation);
+    virtual void scale(QVector3D scaling);
+
+    virtual void dumpObjectInfo(int level = 0) = 0;
+    virtual void dumpObjectTree(int level = 0) = 0;
+
+    bool visible() const;
+    bool highlighted() const;
+    bool selected() const;
+    bool wireFrameMode() const;
+
+    // The flags above combined with the ones inherited from the ancestors,
+    // kept up to date whenever a flag of the entity or an ancestor changes
+    int effectiveFlags() const;
+
+    virtual bool isGizmo() const = 0;
+    virtual bool isLight() const = 0;
+    virtual bool isMesh() const = 0;
+    virtual bool isModel() const = 0;
+
+    virtual QVector3D position() const;
+    virtual QVector3D rotation() const;
+    virtual QVector3D scaling() const;
+
+    // Cached until the entity or one of its ancestors is transformed or reparented
+    virtual QMatrix4x4 localModelMatrix() const;
+    virtual QMatrix4x4 globalModelMatrix() const;
+    QMatrix3x3 globalNormalMatrix() const;
+
+    static AbstractEntity* getHighlighted();
+    static AbstractEntity* getSelected();
+
+public slots:
+    void setVisible(bool visible);
+    void setHighlighted(bool highlighted);
+    void setSelected(bool selected);
+    void setWireFrameMode(bool enabled);
+
+    virtual void setPosition(QVector3D position);
+    virtual void setRotation(QQuaternion rotation);
+    virtual void setRotation(QVector3D rotation);
+    virtual void setScaling(QVector3D scaling);
+
+signals:
+    void visibleChanged(bool visible);
+    void highlightedChanged(bool highlighted);
+    void selectedChanged(bool selected);
+    void wireFrameModeChanged(bool enabled);
+
+    void positionChanged(QVector3D position);
+    void rotationChanged(QVector3D rotation);
+    void scalingChanged(QVector3D scaling);
+
+protected:
+    void childEvent(QChildEvent *event) override;
+    void invalidateTransform();
+    void updateEffectiveFlags();
+
+protected:
+    bool m_visible, m_highlighted, m_selected, m_wireFrameMode;
+    int m_effectiveFlags;
+    QVector3D m_position, m_rotation, m_scaling;
+
+    // Gizmos derive their transform from the host, so neither they nor their
+    // children can cache it
+    bool m_cacheTransform;
+    mutable bool m_localMatrixDirty, m_globalMatrixDirty, m_normalMatrixDirty;
+    mutable QMatrix4x4 m_localModelMatrix, m_globalModelMatrix;
+    mutable QMatrix3x3 m_globalNormalMatrix;
+
+    static AbstractEntity *m_highlightedObject, *m_selectedObject;
+
+private:
+    void invalidateGlobalMatrix();
+};
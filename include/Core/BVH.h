@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Common.h>
+
+// Ray origin + direction * t, with the reciprocal direction kept for slab tests
+struct Ray {
+    QVector3D origin, direction, invDirection;
+
+    Ray();
+    Ray(QVector3D origin, QVector3D direction);
+    Ray(const Line& line);
+};
+
+// Closest hit of a ray against triangles. `distance` is the ray parameter, in world
+// units if the ray direction is normalized.
+struct RayHit {
+    float distance;
+    int triangle;           // index of the triangle in the level 0 index list
+    QVector2D barycentric;  // weights of the second and third corners
+    QVector3D point;        // world space
+
+    RayHit();
+};
+
+// Bounding volume hierarchy over a set of boxes, built top-down with the binned
+// surface area heuristic. Nodes are stored depth first, the left child of an inner
+// node directly follows it.
+class BVH {
+public:
+    struct Node {
+        float minimum[4], maximum[4]; // padded to four floats for SIMD loads
+        int first;                    // leaf: first entry of primitives(), inner: right child
+        int count;                    // primitives in a leaf, 0 for inner nodes
+    };
+
+    // Receives the primitives of the leaves a ray enters, nearest leaf first.
+    // Implementations shrink `maxDistance` when they find a hit.
+    class RayVisitor {
+    public:
+        virtual ~RayVisitor() {}
+        virtual void visit(int primitive, float& maxDistance) = 0;
+    };
+
+    BVH();
+
+    void build(const QVector<AABB>& boxes, int maxLeafSize = 4);
+    void clear();
+
+    bool isEmpty() const;
+    AABB bounds() const;
+    const QVector<Node>& nodes() const;
+    const QVector<int>& primitives() const;
+
+    void raycast(const Ray& ray, float maxDistance, RayVisitor& visitor) const;
+
+    // Entry distance of the ray into the box of `node`, false if it misses it or
+    // enters beyond `maxDistance`
+    static bool intersects(const Node& node, const Ray& ray, float maxDistance, float& entry);
+
+private:
+    QVector<Node> m_nodes;
+    QVector<int> m_primitives;
+};
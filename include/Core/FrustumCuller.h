@@ -0,0 +1,19 @@
+#pragma once
+
+#include <Common.h>
+
+// Tests world space boxes against the planes of a frustum. Batches are processed
+// four boxes at a time with SSE where the compiler targets it.
+class FrustumCuller {
+public:
+    FrustumCuller(const Frustum& frustum);
+
+    bool isVisible(const AABB& box) const;
+
+    // Append the indices of the boxes reaching into the frustum to `visible`, in
+    // order, and return how many were appended. Empty boxes are never visible.
+    int cull(const AABB* boxes, int count, QVector<int>& visible) const;
+
+private:
+    Frustum m_frustum;
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Common.h>
+
+// Content addressed cache of converted models and decoded textures on disk. Entries
+// are keyed by the contents and modification time of the source file, the files it
+// refers to and the import options, once the cache grows past its size limit the
+// least recently used entries are evicted. Safe to use from several threads.
+class ImportCache {
+public:
+    // Read only view of an entry, memory mapped as long as the entry exists
+    class Entry {
+    public:
+        Entry(QString filePath);
+        ~Entry();
+
+        bool isValid() const;
+        const uchar* data() const;
+        qint64 size() const;
+
+        // Points into the mapping, no copy is made
+        QByteArray bytes() const;
+
+    private:
+        QFile m_file;
+        uchar* m_data;
+    };
+
+    static ImportCache* instance();
+
+    bool enabled() const;
+    void setEnabled(bool enabled);
+
+    QString directory() const;
+    void setDirectory(QString directory);
+
+    // Size limit in bytes of all entries together
+    qint64 maxSize() const;
+    void setMaxSize(qint64 maxSize);
+
+    // Empty if the file can't be read or the cache is disabled. The contents of a file
+    // are only hashed again once its size or modification time has changed. The
+    // material libraries of OBJ files are part of the key.
+    QString key(QString filePath, const QByteArray& options);
+
+    // Null on a miss, a hit counts as a use
+    QSharedPointer<Entry> find(QString key);
+
+    // Written atomically, evicts old entries if the limit is exceeded
+    bool insert(QString key, const QByteArray& data);
+
+    // Drop the least recently used entries until the size limit is met
+    void evict();
+
+private:
+    // Hash of a source file and the files it refers to, kept in the cache directory
+    // along with the size and modification time it was taken at
+    struct SourceDigest {
+        qint64 size, modified;
+        QByteArray contents;
+        QStringList references; // absolute paths
+    };
+
+    ImportCache();
+
+    bool digest(QString filePath, SourceDigest& digest);
+
+    mutable QMutex m_mutex;
+    bool m_enabled;
+    QString m_directory;
+    qint64 m_maxSize;
+};
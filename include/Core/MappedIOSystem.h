@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Common.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+// Read only Assimp stream over bytes that are already in memory: a mapping of a
+// disk file or the data of an uncompressed resource. Nothing is copied until the
+// importer reads.
+class MappedIOStream: public Assimp::IOStream {
+public:
+    MappedIOStream(QFile* file, const uchar* data, size_t size);
+    MappedIOStream(const QByteArray& bytes);
+    ~MappedIOStream();
+
+    size_t Read(void* buffer, size_t size, size_t count) override;
+    size_t Write(const void* buffer, size_t size, size_t count) override;
+    aiReturn Seek(size_t offset, aiOrigin origin) override;
+    size_t Tell() const override;
+    size_t FileSize() const override;
+    void Flush() override;
+
+private:
+    QFile* m_file; // owns the mapping, null for resources
+    QByteArray m_bytes; // fallback when nothing can be mapped
+    const uchar* m_data;
+    size_t m_size, m_position;
+};
+
+// Serves disk files through QFile::map and qrc paths straight from QResource, so the
+// importer never reads them into a buffer of its own first. Writing isn't supported.
+class MappedIOSystem: public Assimp::IOSystem {
+public:
+    bool Exists(const char* filePath) const override;
+    char getOsSeparator() const override;
+    Assimp::IOStream* Open(const char* filePath, const char* mode = "rb") override;
+    void Close(Assimp::IOStream* stream) override;
+};
@@ -1,67 +1,163 @@
-#pragma once
-
-#include <AbstractEntity.h>
-#include <Vertex.h>
-#include <Material.h>
-
-class ModelLoader;
-
-class Mesh: public AbstractEntity {
-    Q_OBJECT
-
-public:
-    enum MeshType {
-        Triangle = 0,
-        Line = 1,
-        Point = 2
-    };
-
-    Mesh(QObject * parent = 0);
-    Mesh(MeshType meshType, QObject * parent = 0);
-    Mesh(const Mesh& mesh);
-    ~Mesh();
-
-    void dumpObjectInfo(int level = 0) override;
-    void dumpObjectTree(int level = 0) override;
-
-    bool isGizmo() const override;
-    bool isLight() const override;
-    bool isMesh() const override;
-    bool isModel() const override;
-
-    QVector3D centerOfMass() const;
-    float mass() const;
-
-    MeshType meshType() const;
-    const QVector<Vertex> & vertices() const;
-    const QVector<uint32_t> & indices() const;
-    Material* material() const;
-
-    static Mesh* merge(const Mesh* mesh1, const Mesh* mesh2);
-
-public slots:
-    void setMeshType(MeshType meshType);
-    void setGeometry(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices);
-    bool setMaterial(Material *newMaterial);
-    void reverseNormals();
-    void reverseTangents();
-    void reverseBitangents();
-
-signals:
-    void meshTypeChanged(int meshType);
-    void geometryChanged(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices);
-    void materialChanged(Material* material);
-
-protected:
-    void childEvent(QChildEvent *event) override;
-
-protected:
-    MeshType m_meshType;
-    QVector<Vertex> m_vertices;
-    QVector<uint32_t> m_indices;
-    Material *m_material;
-
-    friend ModelLoader;
-};
-
-QDataStream &operator>>(QDataStream &in, Mesh::MeshType& meshType);
+#pragma once
+
+#include <AbstractEntity.h>
+#include <VertexLayout.h>
+#include <Meshlet.h>
+#include <MeshBVH.h>
+#include <Material.h>
+
+class ModelLoader;
+
+class Mesh: public AbstractEntity {
+    Q_OBJECT
+
+public:
+    enum MeshType {
+        Triangle = 0,
+        Line = 1,
+        Point = 2
+    };
+
+    // How the vertices are kept in memory. Separate storage keeps one stream per
+    // attribute so that passes reading a single attribute don't touch the others.
+    enum StorageMode {
+        Interleaved = 0,
+        Separate = 1
+    };
+
+    Mesh(QObject * parent = 0);
+    Mesh(MeshType meshType, QObject * parent = 0);
+    Mesh(const Mesh& mesh);
+    ~Mesh();
+
+    void dumpObjectInfo(int level = 0) override;
+    void dumpObjectTree(int level = 0) override;
+
+    bool isGizmo() const override;
+    bool isLight() const override;
+    bool isMesh() const override;
+    bool isModel() const override;
+
+    // Dimension of the primitives: 0 for points, 1 for lines, 2 for triangles
+    int dimension() const;
+
+    // Mass properties in the mesh's own space, cached until the geometry changes
+    QVector3D localCenterOfMass() const;
+    float localMass() const;
+
+    // Mass properties in world space
+    QVector3D centerOfMass() const;
+    float mass() const;
+
+    // Mass and first moment of the primitives placed by `modelMat`. The cached local
+    // values are scaled for similarity transforms, other ones are integrated in place.
+    void massProperties(const QMatrix4x4& modelMat, float& mass, QVector3D& moment) const;
+
+    // Bounds in the mesh's own space, cached whenever the geometry changes
+    const AABB& localBoundingBox() const;
+    const Sphere& localBoundingSphere() const;
+
+    // Bounds in world space
+    AABB boundingBox() const;
+    Sphere boundingSphere() const;
+
+    MeshType meshType() const;
+    int vertexLayout() const;
+    StorageMode storageMode() const;
+    int vertexCount() const;
+
+    // Views over the vertex attributes, packed streams in separate storage mode
+    VertexAttributes attributes() const;
+
+    // With separate storage the interleaved array is built on demand and kept until the
+    // vertices change, prefer attributes() in passes over the geometry
+    const QVector<Vertex> & vertices() const;
+    const QVector<uint32_t> & indices() const;
+    Material* material() const;
+
+    // Levels of detail share the vertices, level 0 is the full index list and each
+    // following level is a coarser one. Replacing the geometry drops the chain.
+    int lodCount() const;
+    const QVector<uint32_t> & lodIndices(int level) const;
+    void setLodIndices(const QVector<QVector<uint32_t>>& lods);
+
+    // Clusters covering the full index list in order, empty if the mesh isn't clustered.
+    // `indices` must hold the same triangles as the current ones, reordered so that
+    // each meshlet is contiguous. Changing any vertex drops the clusters.
+    const QVector<Meshlet> & meshlets() const;
+    void setMeshlets(const QVector<uint32_t>& indices, const QVector<Meshlet>& meshlets);
+
+    // Identifies the current vertices, indices, LODs and meshlets. Copies of a mesh
+    // share their arrays and keep the same id until one of them is modified.
+    quint64 geometryId() const;
+
+    // Triangle hierarchy of the full detail level, built on first use and shared by
+    // copies until the geometry changes. Null for line and point meshes.
+    QSharedPointer<const MeshBVH> bvh() const;
+
+    // Nearest triangle hit by a world space ray, placed by `modelMat` or by the global
+    // transform. `hit` is only written if a triangle is closer than `maxDistance`.
+    bool raycast(const Line& ray, RayHit& hit, float maxDistance = inf) const;
+    bool raycast(const Line& ray, const QMatrix4x4& modelMat, RayHit& hit, float maxDistance = inf) const;
+
+    void setStorageMode(StorageMode storageMode);
+
+    // Take over the arrays without comparing them against the current geometry
+    void setGeometry(QVector<Vertex>&& vertices, QVector<uint32_t>&& indices);
+
+    // Overwrite `count` vertices starting at `offset`, the topology is unchanged
+    void updateVertices(int offset, const Vertex* vertices, int count);
+
+    // Bake the global transforms of the meshes into a single new mesh
+    static Mesh* merge(const Mesh* mesh1, const Mesh* mesh2);
+    static Mesh* merge(const QVector<const Mesh*>& meshes);
+
+public slots:
+    void setMeshType(MeshType meshType);
+    void setVertexLayout(int options);
+    void setGeometry(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices);
+    bool setMaterial(Material *newMaterial);
+    void reverseNormals();
+    void reverseTangents();
+    void reverseBitangents();
+
+signals:
+    void meshTypeChanged(int meshType);
+    void vertexLayoutChanged(int options);
+    // `vertices` is empty in separate storage mode
+    void geometryChanged(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices);
+    void verticesUpdated(int offset, int count);
+    void lodsChanged();
+    void meshletsChanged();
+    void materialChanged(Material* material);
+
+protected:
+    void childEvent(QChildEvent *event) override;
+    void updateBounds();
+    void updateMass() const;
+    void integrateMass(const QMatrix4x4& modelMat, float& mass, QVector3D& moment) const;
+    bool sameVertices(const QVector<Vertex>& vertices) const;
+
+protected:
+    MeshType m_meshType;
+    int m_vertexLayout;
+    StorageMode m_storageMode;
+    mutable QVector<Vertex> m_vertices; // interleaved vertices, or their cache in separate mode
+    VertexStreams m_streams;
+    QVector<uint32_t> m_indices;
+    QVector<QVector<uint32_t>> m_lodIndices;
+    QVector<Meshlet> m_meshlets;
+    quint64 m_geometryId;
+    mutable QSharedPointer<const MeshBVH> m_bvh;
+    mutable quint64 m_bvhGeometryId;
+    Material *m_material;
+    AABB m_localBoundingBox;
+    Sphere m_localBoundingSphere;
+    mutable bool m_massDirty;
+    mutable float m_localMass;
+    mutable QVector3D m_localCenterOfMass;
+
+    friend ModelLoader;
+};
+
+QDataStream &operator>>(QDataStream &in, Mesh::MeshType& meshType);
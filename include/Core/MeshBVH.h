@@ -0,0 +1,23 @@
+#pragma once
+
+#include <BVH.h>
+#include <VertexStreams.h>
+
+// Triangle hierarchy of a mesh for ray queries in the mesh's own space. The corners
+// are copied in leaf order so that a leaf test reads one contiguous block.
+class MeshBVH {
+public:
+    MeshBVH(const VertexAttributes& attributes, const QVector<uint32_t>& indices);
+
+    int triangleCount() const;
+    const BVH& tree() const;
+
+    // Nearest triangle hit closer than `maxDistance`, both faces count. Only the
+    // distance, triangle and barycentric fields of `hit` are filled in.
+    bool raycast(const Ray& ray, float maxDistance, RayHit& hit) const;
+
+private:
+    BVH m_tree;
+    QVector<QVector3D> m_corners;   // three per triangle, in the order of m_tree.primitives()
+    QVector<int> m_slots;           // triangle -> its position in m_corners / 3
+};
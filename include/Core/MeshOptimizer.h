@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Mesh.h>
+
+// Reorders the triangles and vertices of triangle meshes for faster rendering.
+// None of the passes change the shape of the mesh.
+class MeshOptimizer {
+public:
+    enum Option {
+        None = 0x00,
+        VertexCache = 0x01,  // reorder triangles for post-transform vertex cache locality
+        Overdraw = 0x02,     // reorder clusters of triangles to draw the outer surface first
+        VertexFetch = 0x04,  // reorder vertices by first use, unreferenced vertices are dropped
+        All = VertexCache | Overdraw | VertexFetch
+    };
+
+    // Vertex cache efficiency of an optimization, the ACMRs are 0 if nothing was done
+    struct Statistics {
+        int triangles;
+        float acmrBefore, acmrAfter;
+    };
+
+    static Statistics optimize(Mesh* mesh, int options = All);
+    static Statistics optimize(QVector<Vertex>& vertices, QVector<uint32_t>& indices, int options = All);
+
+    // Forsyth's linear-speed vertex cache optimization
+    static void optimizeVertexCache(QVector<uint32_t>& indices, int vertexCount);
+
+    // Sander et al.'s cluster sorting, clusters are split where the vertex cache
+    // efficiency degrades by less than `threshold`
+    static void optimizeOverdraw(const QVector<Vertex>& vertices, QVector<uint32_t>& indices, float threshold = 1.05f);
+
+    static void optimizeVertexFetch(QVector<Vertex>& vertices, QVector<uint32_t>& indices);
+
+    // Split the triangles into clusters of at most `maxVertices` distinct vertices and
+    // `maxTriangles` triangles, grown across shared vertices. The indices are reordered
+    // so that each cluster is a contiguous range.
+    static void buildMeshlets(Mesh* mesh, int maxVertices = 64, int maxTriangles = 124);
+    static QVector<Meshlet> buildMeshlets(const QVector<Vertex>& vertices, QVector<uint32_t>& indices,
+                                          int maxVertices = 64, int maxTriangles = 124);
+
+    // Average cache miss ratio: transformed vertices per triangle with a FIFO cache
+    static float computeACMR(const QVector<uint32_t>& indices, int vertexCount, int cacheSize = 16);
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Mesh.h>
+
+// Quadric error metric simplification of triangle meshes. Edges are collapsed onto
+// one of their existing vertices, so the simplified index lists still refer to the
+// original vertex array and every level of detail can share one vertex buffer.
+class MeshSimplifier {
+public:
+    // Collapse edges until at most `targetIndexCount` indices are left or no edge can
+    // be collapsed any more. Border and attribute seam vertices never move.
+    static QVector<uint32_t> simplify(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices, int targetIndexCount);
+
+    // Build up to `levelCount` levels of detail, each keeping `ratio` of the
+    // triangles of the previous one. Stops early once a level can't be reduced.
+    static void generateLods(Mesh* mesh, int levelCount = 4, float ratio = 0.5f);
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Common.h>
+
+// A cluster of triangles stored as a contiguous range of a mesh's indices.
+// The normal cone bounds the face normals: no triangle faces away from `coneAxis`
+// by more than the cone angle, whose sine is stored as `coneCutoff`.
+struct Meshlet {
+    int indexOffset, indexCount;
+    Sphere bounds;
+    QVector3D coneAxis;
+    float coneCutoff; // 1 if the cone is too wide to ever cull
+
+    Meshlet();
+
+    // Whether every triangle faces away from `viewPos`, given in the mesh's own space
+    bool isBackFacing(QVector3D viewPos) const;
+};
+
+QDataStream &operator<<(QDataStream &out, const Meshlet& meshlet);
+QDataStream &operator>>(QDataStream &in, Meshlet& meshlet);
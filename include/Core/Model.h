@@ -1,52 +1,78 @@
-#pragma once
-
-#include <Mesh.h>
-
-class Model: public AbstractEntity {
-    Q_OBJECT
-
-public:
-    Model(QObject * parent = 0);
-    Model(const Model& model);
-    ~Model();
-
-    bool addChildMesh(Mesh* mesh);
-    bool addChildModel(Model* model);
-
-    bool removeChildMesh(QObject* mesh, bool recursive);
-    bool removeChildModel(QObject* model, bool recursive);
-
-    void dumpObjectInfo(int level = 0) override;
-    void dumpObjectTree(int level = 0) override;
-
-    bool isGizmo() const override;
-    bool isLight() const override;
-    bool isMesh() const override;
-    bool isModel() const override;
-
-    QVector3D centerOfMass() const;
-    float mass() const;
-
-    Mesh* assemble() const;
-
-    const QVector<Mesh*> & childMeshes() const;
-    const QVector<Model*> & childModels() const;
-
-public slots:
-    void reverseNormals();
-    void reverseTangents();
-    void reverseBitangents();
-
-signals:
-    void childMeshAdded(Mesh* mesh);
-    void childMeshRemoved(QObject* object);
-    void childModelAdded(Model* model);
-    void childModelRemoved(QObject* object);
-
-protected:
-    void childEvent(QChildEvent *event) override;
-
-private:
-    QVector<Mesh*> m_childMeshes;
-    QVector<Model*> m_childModels;
-};
+#pragma once
+
+#include <Mesh.h>
+
+class Model: public AbstractEntity {
+    Q_OBJECT
+
+public:
+    Model(QObject * parent = 0);
+    Model(const Model& model);
+    ~Model();
+
+    bool addChildMesh(Mesh* mesh);
+    bool addChildModel(Model* model);
+
+    bool removeChildMesh(QObject* mesh, bool recursive);
+    bool removeChildModel(QObject* model, bool recursive);
+
+    void dumpObjectInfo(int level = 0) override;
+    void dumpObjectTree(int level = 0) override;
+
+    bool isGizmo() const override;
+    bool isLight() const override;
+    bool isMesh() const override;
+    bool isModel() const override;
+
+    // Mass properties in world space, combined from the cached moments of the children
+    QVector3D centerOfMass() const;
+    float mass() const;
+
+    // Bounds of all children in the model's own space, cached until a child changes
+    const AABB& localBoundingBox() const;
+    const Sphere& localBoundingSphere() const;
+
+    // Bounds in world space
+    AABB boundingBox() const;
+    Sphere boundingSphere() const;
+
+    Mesh* assemble() const;
+    void collectMeshes(QVector<const Mesh*>& meshes) const;
+
+    const QVector<Mesh*> & childMeshes() const;
+    const QVector<Model*> & childModels() const;
+
+public slots:
+    void invalidateBounds(); // also drops the cached mass properties
+    void reverseNormals();
+    void reverseTangents();
+    void reverseBitangents();
+
+signals:
+    void childMeshAdded(Mesh* mesh);
+    void childMeshRemoved(QObject* object);
+    void childModelAdded(Model* model);
+    void childModelRemoved(QObject* object);
+    void boundsChanged();
+
+protected:
+    void childEvent(QChildEvent *event) override;
+
+private:
+    QVector<Mesh*> m_childMeshes;
+    QVector<Model*> m_childModels;
+
+    mutable bool m_boundsDirty;
+    mutable AABB m_localBoundingBox;
+    mutable Sphere m_localBoundingSphere;
+
+    // Mass and first moment of the points, lines and triangles in the model's own space
+    mutable bool m_massDirty;
+    mutable float m_localMass[3];
+    mutable QVector3D m_localMoment[3];
+
+    void updateBounds() const;
+    void updateMass() const;
+    void massProperties(const QMatrix4x4& modelMat, float mass[3], QVector3D moment[3]) const;
+    void accumulateMass(const QMatrix4x4& modelMat, float mass[3], QVector3D moment[3]) const;
+};
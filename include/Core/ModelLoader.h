@@ -1,37 +1,141 @@
-#pragma once
-
-#include <TextureLoader.h>
-#include <Model.h>
-
-struct aiScene;
-struct aiNode;
-struct aiMesh;
-struct aiMaterial;
-
-class ModelLoader {
-public:
-    ModelLoader();
-
-    Model* loadModelFromFile(QString filePath);
-    Mesh* loadMeshFromFile(QString filePath);
-
-    static Model* loadConeModel();
-    static Model* loadCubeModel();
-    static Model* loadCylinderModel();
-    static Model* loadPlaneModel();
-    static Model* loadSphereModel();
-
-    bool hasErrorLog();
-    QString errorLog();
-
-private:
-    QDir m_dir;
-    QString m_log;
-    TextureLoader textureLoader;
-
-    const aiScene* m_aiScenePtr;
-
-    Model* loadModel(const aiNode* aiNodePtr);
-    Mesh* loadMesh(const aiMesh* aiMeshPtr);
-    Material* loadMaterial(const aiMaterial* aiMaterialPtr);
-};
+#pragma once
+
+#include <TextureLoader.h>
+#include <MeshOptimizer.h>
+#include <MeshSimplifier.h>
+#include <Model.h>
+#include <NativeModelReader.h>
+
+struct aiScene;
+struct aiNode;
+struct aiMesh;
+struct aiMaterial;
+
+class ModelLoader {
+public:
+    // How much post-processing an import runs, trading quality for import time
+    enum ImportProfile {
+        FullQuality, // smooth normals, tangents, welded vertices and the mesh options below
+        FastPreview, // just enough to look at the model, no optimization, LODs or meshlets
+        CAD          // no textures, texture coordinates or tangents, keeps hard edges and the node tree
+    };
+
+    // Wall clock time of each stage of an import in milliseconds, 0 for stages that
+    // didn't run. Only the cache lookup runs if the import cache has the model.
+    struct ImportTimings {
+        qint64 cacheLookup, read, postProcess, convert, assemble, cacheStore, total;
+        bool cacheHit;
+
+        // Vertex cache efficiency of the meshes the optimizer ran on, averaged over
+        // their triangles. All 0 if it didn't run.
+        int optimizedTriangles;
+        float acmrBefore, acmrAfter;
+
+        // Why the native readers left the file to Assimp, empty if they didn't
+        QString fallbackReason;
+
+        ImportTimings();
+    };
+
+    ModelLoader();
+
+    Model* loadModelFromFile(QString filePath);
+    Mesh* loadMeshFromFile(QString filePath);
+
+    // Import on a thread of the global pool with the current options. The future
+    // reports progress from 0 to 100 and can be canceled, its result is the model
+    // moved to the calling thread, none if loading failed or was canceled. Errors go
+    // to the log of this loader, which has to outlive the future.
+    QFuture<Model*> loadModelFromFileAsync(QString filePath);
+
+    // MeshOptimizer options applied to every imported mesh
+    int meshOptimization() const;
+    void setMeshOptimization(int options);
+
+    // Levels of detail generated for every imported mesh, 0 to disable
+    int lodLevels() const;
+    void setLodLevels(int levels);
+
+    // Split every imported triangle mesh into meshlets for culling
+    bool enableMeshlets() const;
+    void setEnableMeshlets(bool enabled);
+
+    ImportProfile importProfile() const;
+    void setImportProfile(ImportProfile profile);
+
+    // Read OBJ, binary PLY and binary STL files with NativeModelReader instead of
+    // Assimp, which stays the fallback for every other file
+    bool enableNativeReaders() const;
+    void setEnableNativeReaders(bool enabled);
+
+    // How the vertices of the imported meshes are kept in memory
+    Mesh::StorageMode storageMode() const;
+    void setStorageMode(Mesh::StorageMode storageMode);
+
+    // Stages of the last import loadModelFromFile() did on the calling thread
+    ImportTimings lastImportTimings();
+
+    // Stages of the asynchronous import behind `future` once it has finished. They
+    // are handed out once, all 0 if the import was canceled or taken already.
+    ImportTimings takeImportTimings(const QFuture<Model*>& future);
+
+    static Model* loadConeModel(int segments = 50);
+    static Model* loadCubeModel();
+    static Model* loadCylinderModel(int segments = 50);
+    static Model* loadPlaneModel(int divisions = 1);
+    static Model* loadSphereModel(int segments = 50, int rings = 50);
+
+    bool hasErrorLog();
+    QString errorLog();
+
+private:
+    QDir m_dir;
+    QString m_log;
+    QMutex m_logMutex; // also guards m_importTimings, written by the async imports
+    QFutureInterface<Model*>* m_future; // progress and cancellation of an async import
+    TextureLoader textureLoader;
+    int m_meshOptimization;
+    int m_lodLevels;
+    bool m_enableMeshlets;
+    ImportProfile m_importProfile;
+    bool m_enableNativeReaders;
+    Mesh::StorageMode m_storageMode;
+    ImportTimings m_timings;
+    QVector<QPair<QFuture<Model*>, ImportTimings>> m_importTimings;
+
+    const aiScene* m_aiScenePtr;
+    QVector<Mesh*> m_meshes; // converted meshes of m_aiScenePtr, not yet placed in a model
+    QVector<QVector3D> m_meshPositions;
+    QVector<bool> m_meshUsed;
+
+    struct MeshJob;
+    friend class ImportTask;
+
+    unsigned int postProcessFlags(QString filePath) const;
+    void recordTimings(QString filePath, const ImportTimings& timings);
+
+    Model* loadAssimpModel(QString filePath, unsigned int flags, ImportTimings& timings, QElapsedTimer& timer);
+    Model* loadNativeModel(QString filePath, ImportTimings& timings, QElapsedTimer& timer);
+
+    void loadMeshes(ImportTimings& timings);
+    void runMeshJobs(QVector<MeshJob>& jobs, ImportTimings& timings);
+    Model* loadModel(const aiNode* aiNodePtr);
+    Mesh* takeMesh(uint32_t index);
+    Material* loadMaterial(const aiMaterial* aiMaterialPtr);
+    Material* loadMaterial(const NativeModelReader::MaterialInfo& info);
+    QString texturePath(QString path) const;
+
+    static void centerChildren(Model* model);
+
+    // Run on a pool thread, touch nothing but the job
+    static void loadMesh(MeshJob& job);
+    static Mesh* convertMesh(const aiMesh* aiMeshPtr, bool tangents);
+
+    // Converted hierarchy as stored in the import cache
+    QByteArray cacheModel(Model* model);
+    void cacheModel(Model* model, QDataStream& out, QHash<quint64, int>& geometries, int& meshCount);
+    void cacheMesh(Mesh* mesh, QDataStream& out, QHash<quint64, int>& geometries, int& meshCount);
+    Model* loadCachedModel(const QByteArray& bytes);
+    Model* loadCachedModel(QDataStream& in, QVector<Mesh*>& meshes);
+    Mesh* loadCachedMesh(QDataStream& in, QVector<Mesh*>& meshes);
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Vertex.h>
+
+// Reads OBJ, binary PLY and binary STL files without Assimp. The file is memory
+// mapped and cut into chunks that are parsed on the global thread pool, the meshes
+// come out as the engine's vertices and triangle indices. Missing normals and the
+// tangents are generated the way Assimp's post-processing would. A file this reader
+// can't handle fails to read and is left to Assimp by ModelLoader.
+class NativeModelReader {
+public:
+    enum TangentMode {
+        NoTangents,         // meshes get a layout without a tangent frame
+        BumpMappedTangents, // only meshes whose material has a bump map get one
+        AllTangents
+    };
+
+    // Material of an OBJ file, with Assimp's defaults for the values it leaves out.
+    // Texture paths are as written in the material library.
+    struct MaterialInfo {
+        MaterialInfo();
+
+        QString name;
+        QVector3D ambient, diffuse, specular;
+        float shininess;
+        QString diffuseTexture, specularTexture, bumpTexture;
+    };
+
+    struct MeshData {
+        QString name;
+        QVector<Vertex> vertices;
+        QVector<uint32_t> indices;
+        int material; // index into materials(), -1 for the default material
+        bool tangents; // false if the mesh should go without a tangent frame
+    };
+
+    NativeModelReader();
+
+    // Whether the file is in one of the formats above, checked by extension and header
+    static bool canRead(QString filePath);
+
+    // Texture coordinates aren't read, as for the CAD import profile
+    bool ignoreTexCoords() const;
+    void setIgnoreTexCoords(bool ignore);
+
+    TangentMode tangentMode() const;
+    void setTangentMode(TangentMode mode);
+
+    // Generated normals are only averaged across edges flatter than this, in degrees
+    float maxSmoothingAngle() const;
+    void setMaxSmoothingAngle(float degrees);
+
+    // Polled by every chunk, reading stops once the future is canceled
+    void setFuture(const QFutureInterfaceBase* future);
+
+    bool read(QString filePath);
+    QString errorString() const;
+
+    // The arrays can be swapped out, nothing else refers to them
+    QVector<MeshData>& meshes();
+    const QVector<MaterialInfo>& materials() const;
+
+private:
+    bool m_ignoreTexCoords;
+    TangentMode m_tangentMode;
+    float m_maxSmoothingAngle;
+    const QFutureInterfaceBase* m_future;
+    QString m_error;
+    QVector<MeshData> m_meshes;
+    QVector<MaterialInfo> m_materials;
+
+    bool readObj(QString filePath, const char* data, qint64 size);
+    bool readPly(QString filePath, const char* data, qint64 size);
+    bool readStl(QString filePath, const char* data, qint64 size);
+    void readMaterialLibrary(QString filePath, QHash<QByteArray, int>& materialIndices);
+    bool isCanceled() const;
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <Mesh.h>
+
+// Built in shapes. Each shape and tessellation is generated or parsed once, every
+// mesh returned is a copy sharing the arrays (and so the GPU buffers) of the first.
+class Primitive {
+public:
+    // Radius 1 and height 1 around the origin, cube and plane span 1
+    static Mesh* cone(int segments = 50);
+    static Mesh* cube();
+    static Mesh* cylinder(int segments = 50);
+    static Mesh* plane(int divisions = 1); // in the XZ plane, facing +Y
+    static Mesh* sphere(int segments = 50, int rings = 50);
+
+    // Mesh assembled from a model in the resources, e.g. the gizmo and light markers
+    static Mesh* resourceMesh(QString filePath);
+
+private:
+    static QHash<QString, Mesh*> m_prototypes;
+    static QMutex m_mutex;
+
+    static Mesh* copy(QString key, Mesh* (*generate)(int, int), int a, int b);
+    static Mesh* generateCone(int segments, int);
+    static Mesh* generateCube(int, int);
+    static Mesh* generateCylinder(int segments, int);
+    static Mesh* generatePlane(int divisions, int);
+    static Mesh* generateSphere(int segments, int rings);
+};
@@ -1,78 +1,131 @@
-#pragma once
-
-#include <TransformGizmo.h>
-#include <Camera.h>
-#include <Gridline.h>
-#include <AmbientLight.h>
-#include <DirectionalLight.h>
-#include <PointLight.h>
-#include <SpotLight.h>
-#include <Model.h>
-
-class SceneLoader;
-class SceneSaver;
-
-class Scene: public QObject {
-    Q_OBJECT
-
-public:
-    Scene();
-    Scene(const Scene& scene);
-    ~Scene();
-
-    bool setCamera(Camera* camera);
-    bool addGridline(Gridline* gridline);
-    bool addLight(AbstractLight* light);
-    bool addAmbientLight(AmbientLight* light);
-    bool addDirectionalLight(DirectionalLight* light);
-    bool addPointLight(PointLight* light);
-    bool addSpotLight(SpotLight* light);
-    bool addModel(Model* model);
-
-    bool removeGridline(QObject* gridline);
-    bool removeLight(QObject* light);
-    bool removeModel(QObject* model, bool recursive);
-
-    void dumpObjectInfo(int level = 0);
-    void dumpObjectTree(int level = 0);
-
-    TransformGizmo* transformGizmo() const;
-    Camera* camera() const;
-    const QVector<Gridline*>& gridlines() const;
-    const QVector<AmbientLight*>& ambientLights() const;
-    const QVector<DirectionalLight*>& directionalLights() const;
-    const QVector<PointLight*>& pointLights() const;
-    const QVector<SpotLight*>& spotLights() const;
-    const QVector<Model*>& models() const;
-
-signals:
-    void cameraChanged(Camera* camera);
-    void gridlineAdded(Gridline* gridline);
-    void gridlineRemoved(QObject* object);
-    void lightAdded(AbstractLight* light);
-    void lightRemoved(QObject* object);
-    void modelAdded(Model* model);
-    void modelRemoved(QObject* object);
-
-protected:
-    void childEvent(QChildEvent *event) override;
-
-private:
-    TransformGizmo * m_gizmo;
-    Camera * m_camera;
-    QVector<Gridline*> m_gridlines;
-    QVector<AmbientLight*> m_ambientLights;
-    QVector<DirectionalLight*> m_directionalLights;
-    QVector<PointLight*> m_pointLights;
-    QVector<SpotLight*> m_spotLights;
-    QVector<Model*> m_models;
-
-    int m_gridlineNameCounter;
-    int m_ambientLightNameCounter;
-    int m_directionalLightNameCounter;
-    int m_pointLightNameCounter;
-    int m_spotLightNameCounter;
-
-    friend SceneLoader;
-    friend SceneSaver;
-};
+#pragma once
+
+#include <TransformGizmo.h>
+#include <Camera.h>
+#include <Gridline.h>
+#include <AmbientLight.h>
+#include <DirectionalLight.h>
+#include <PointLight.h>
+#include <SpotLight.h>
+#include <Model.h>
+#include <SceneBVH.h>
+
+class SceneLoader;
+class SceneSaver;
+
+class Scene: public QObject {
+    Q_OBJECT
+
+public:
+    Scene();
+    Scene(const Scene& scene);
+    ~Scene();
+
+    bool setCamera(Camera* camera);
+    bool addGridline(Gridline* gridline);
+    bool addLight(AbstractLight* light);
+    bool addAmbientLight(AmbientLight* light);
+    bool addDirectionalLight(DirectionalLight* light);
+    bool addPointLight(PointLight* light);
+    bool addSpotLight(SpotLight* light);
+    bool addModel(Model* model);
+
+    bool removeGridline(QObject* gridline);
+    bool removeLight(QObject* light);
+    bool removeModel(QObject* model, bool recursive);
+
+    void dumpObjectInfo(int level = 0);
+    void dumpObjectTree(int level = 0);
+
+    TransformGizmo* transformGizmo() const;
+    Camera* camera() const;
+    const QVector<Gridline*>& gridlines() const;
+    const QVector<AmbientLight*>& ambientLights() const;
+    const QVector<DirectionalLight*>& directionalLights() const;
+    const QVector<PointLight*>& pointLights() const;
+    const QVector<SpotLight*>& spotLights() const;
+    const QVector<Model*>& models() const;
+
+    // World space bounds of all models, cached until a model changes
+    const AABB& boundingBox() const;
+    const Sphere& boundingSphere() const;
+
+    // Spatial queries over the meshes of all models in world space. They share one
+    // dynamic BVH, in which only the meshes that moved, changed, or were added or
+    // removed since the last query are refit or relinked. It is rebuilt after enough
+    // of those edits.
+    // Nearest visible triangle mesh hit by the ray, 0 if none
+    Mesh* raycast(const Line& ray, RayHit* hit = 0) const;
+    // Meshes whose bounds reach into the frustum or the box, whether visible or not
+    QVector<Mesh*> meshesInFrustum(const Frustum& frustum) const;
+    QVector<Mesh*> meshesOverlapping(const AABB& box) const;
+    // The k meshes with bounds closest to the point, nearest first
+    QVector<Mesh*> nearestMeshes(QVector3D point, int k) const;
+
+public slots:
+    void invalidateBounds();
+
+private slots:
+    void indexedMeshChanged();
+    void indexedModelMoved();
+    void indexedMeshAdded(Mesh* mesh);
+    void indexedModelAdded(Model* model);
+    void indexedChildRemoved(QObject* object);
+
+signals:
+    void cameraChanged(Camera* camera);
+    void gridlineAdded(Gridline* gridline);
+    void gridlineRemoved(QObject* object);
+    void lightAdded(AbstractLight* light);
+    void lightRemoved(QObject* object);
+    void modelAdded(Model* model);
+    void modelRemoved(QObject* object);
+    void boundsChanged();
+
+protected:
+    void childEvent(QChildEvent *event) override;
+
+private:
+    TransformGizmo * m_gizmo;
+    Camera * m_camera;
+    QVector<Gridline*> m_gridlines;
+    QVector<AmbientLight*> m_ambientLights;
+    QVector<DirectionalLight*> m_directionalLights;
+    QVector<PointLight*> m_pointLights;
+    QVector<SpotLight*> m_spotLights;
+    QVector<Model*> m_models;
+
+    int m_gridlineNameCounter;
+    int m_ambientLightNameCounter;
+    int m_directionalLightNameCounter;
+    int m_pointLightNameCounter;
+    int m_spotLightNameCounter;
+
+    mutable bool m_boundsDirty;
+    mutable AABB m_boundingBox;
+    mutable Sphere m_boundingSphere;
+
+    mutable bool m_meshIndexDirty;
+    mutable SceneBVH m_meshIndex;
+    mutable QHash<QObject*, int> m_meshProxies;      // meshes linked into the index
+    mutable float m_meshIndexBuildCost;
+    mutable int m_meshIndexEdits; // leaves added or removed since the last rebuild
+
+    // Every mesh and model of the scene is tracked for the index, the models with
+    // their children as they were when tracked. Objects are only compared by address
+    // once removed, as they may be destroyed by then.
+    QSet<QObject*> m_indexedMeshes;
+    QHash<QObject*, QVector<QObject*>> m_indexedModels;
+    mutable QSet<QObject*> m_dirtyMeshes;   // to be linked or refit
+    mutable QSet<QObject*> m_dirtyModels;   // all meshes below to be refit
+
+    void updateBounds() const;
+    void updateMeshIndex() const;
+    void refitModel(QObject* model) const;
+    void trackMesh(Mesh* mesh);
+    void trackModel(Model* model);
+    void untrack(QObject* object);
+
+    friend SceneLoader;
+    friend SceneSaver;
+};
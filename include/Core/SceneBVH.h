@@ -0,0 +1,59 @@
+#pragma once
+
+#include <BVH.h>
+
+class Mesh;
+
+// Dynamic bounding volume hierarchy over the world bounds of the meshes of a scene.
+// Moving a mesh refits the boxes on its path to the root, adding or removing one
+// links a single leaf. The SAH rebuild restores the quality of the tree after many
+// such edits.
+class SceneBVH {
+public:
+    SceneBVH();
+
+    // Each returns the proxy of the leaf, which stays valid until it is removed
+    int insert(Mesh* mesh, const AABB& box);
+    void remove(int proxy);
+    // Refit the ancestors of the leaf, false if the box is unchanged
+    bool update(int proxy, const AABB& box);
+    void rebuild();
+    void clear();
+
+    int size() const;
+    Mesh* mesh(int proxy) const;
+    const AABB& box(int proxy) const;
+    AABB bounds() const;
+
+    // Summed surface area of the inner nodes, the tree is worth rebuilding once it
+    // grows well past the value right after a rebuild
+    float cost() const;
+
+    void query(const Frustum& frustum, QVector<Mesh*>& meshes) const;
+    void query(const AABB& box, QVector<Mesh*>& meshes) const;
+    // Visits the leaves entered by the ray nearest first, the primitive is the proxy
+    void raycast(const Ray& ray, float maxDistance, BVH::RayVisitor& visitor) const;
+    // The k meshes whose boxes are closest to `point`, nearest first
+    void nearest(QVector3D point, int k, QVector<Mesh*>& meshes) const;
+
+private:
+    struct Node {
+        AABB box;
+        Mesh* mesh;     // 0 for inner nodes
+        int parent;
+        int child[2];   // -1 for leaves
+        int next;       // free list link
+    };
+
+    QVector<Node> m_nodes;
+    int m_root;
+    int m_freeList;
+    int m_leafCount;
+
+    int allocateNode();
+    void freeNode(int node);
+    void insertLeaf(int leaf);
+    void removeLeaf(int leaf);
+    void refit(int node);
+    void collectLeaves(int node, QVector<Mesh*>& meshes) const;
+};
@@ -1,17 +1,23 @@
-#pragma once
-
-#include <Texture.h>
-
-class TextureLoader {
-public:
-    TextureLoader() {}
-
-    QSharedPointer<Texture> loadFromFile(Texture::TextureType textureType, QString filePath);
-
-    bool hasErrorLog();
-    QString errorLog();
-
-private:
-    QString m_log;
-    static QHash<QString, QWeakPointer<Texture> > cache;
-};
+#pragma once
+
+#include <Texture.h>
+
+class TextureLoader {
+public:
+    TextureLoader() {}
+
+    // Safe to call from several threads, new textures belong to the application thread.
+    // The image is decoded on the global thread pool, the texture shows a placeholder
+    // until then. Requests for a path already loading share its texture.
+    QSharedPointer<Texture> loadFromFile(Texture::TextureType textureType, QString filePath);
+
+    bool hasErrorLog();
+    QString errorLog();
+
+private:
+    QString m_log;
+    static QHash<QString, QWeakPointer<Texture> > cache;
+    static QMutex cacheMutex;
+
+    static QSharedPointer<Texture> cachedTexture(QString filePath);
+};
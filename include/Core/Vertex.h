@@ -1,26 +1,50 @@
-#pragma once
-
-#include <Common.h>
-
-class Vertex {
-public:
-    Vertex(QVector3D _position = QVector3D(0, 0, 0),
-           QVector3D _normal = QVector3D(0, 0, 1),
-           QVector3D _tangent = QVector3D(0, 1, 0),
-           QVector3D _bitangent = QVector3D(1, 0, 0),
-           QVector2D _texCoords = QVector2D(0, 0));
-    Vertex(const Vertex &other);
-
-    Vertex& operator=(const Vertex &other);
-    bool operator==(const Vertex &other) const;
-
-    QVector3D position;
-    QVector3D normal;
-    QVector3D tangent;
-    QVector3D bitangent;
-    QVector2D texCoords;
-};
-
-Vertex operator*(QMatrix4x4 mat, const Vertex& vertex);
-QDataStream &operator<<(QDataStream &out, const Vertex& vertex);
-QDataStream &operator>>(QDataStream &in, Vertex& vertex);
+#pragma once
+
+#include <Common.h>
+
+class Vertex {
+public:
+    Vertex(QVector3D _position = QVector3D(0, 0, 0),
+           QVector3D _normal = QVector3D(0, 0, 1),
+           QVector3D _tangent = QVector3D(0, 1, 0),
+           QVector3D _bitangent = QVector3D(1, 0, 0),
+           QVector2D _texCoords = QVector2D(0, 0));
+    Vertex(const Vertex &other);
+
+    Vertex& operator=(const Vertex &other);
+    bool operator==(const Vertex &other) const;
+
+    QVector3D position;
+    QVector3D normal;
+    QVector3D tangent;
+    QVector3D bitangent;
+    QVector2D texCoords;
+};
+
+Vertex operator*(QMatrix4x4 mat, const Vertex& vertex);
+
+// Transform `count` vertices by one matrix: positions as points, tangents and
+// bitangents as directions, normals by the normal matrix computed once per call.
+// `src` and `dst` may be the same array. Uses the fastest kernel the CPU supports.
+void transformVertices(const QMatrix4x4& mat, const Vertex* src, Vertex* dst, int count);
+
+// The kernels behind transformVertices(), from slowest to fastest. AVX is detected at
+// run time, SSE2 is available whenever the compiler targets it.
+enum TransformKernel {
+    ScalarKernel,
+    Sse2Kernel,
+    AvxKernel
+};
+
+bool transformKernelSupported(TransformKernel kernel);
+
+// Falls back to the next slower kernel if `kernel` isn't supported
+void transformVertices(TransformKernel kernel, const QMatrix4x4& mat, const Vertex* src, Vertex* dst, int count);
+
+// Make the tangents of `count` vertices orthogonal to their normals and flip them
+// where the texture coordinates are mirrored, giving the left-handed tangent space
+// the shaders expect
+void orthogonalizeTangents(Vertex* vertices, int count);
+
+QDataStream &operator<<(QDataStream &out, const Vertex& vertex);
+QDataStream &operator>>(QDataStream &in, Vertex& vertex);
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <VertexStreams.h>
+
+// Describes how the attributes of a Vertex are packed into a GPU vertex buffer.
+// The attribute locations match the ones declared in the shaders:
+// 0: position, 1: normal, 2: tangent, 3: bitangent, 4: texCoords
+class VertexLayout {
+public:
+    enum Option {
+        Standard = 0x00,            // 56 bytes, all attributes stored as floats
+        OctahedralNormals = 0x01,   // normal packed into 2 x int16
+        PackedTangents = 0x02,      // tangent + handedness packed into 4 x int8, bitangent rebuilt in shader
+        HalfFloatTexCoords = 0x04,  // texture coordinates stored as 2 x half float
+        QuantizedPositions = 0x08,  // position quantized to 3 x uint16 within the mesh bounds
+        OptionalTangents = 0x10,    // omit the tangent frame if the material has no bump map
+        NoTangents = 0x20,          // omit the tangent frame
+        Compact = OctahedralNormals | PackedTangents | HalfFloatTexCoords | OptionalTangents
+    };
+
+    struct Attribute {
+        GLuint location;
+        GLint size;
+        GLenum type;
+        GLboolean normalized;
+        int offset;
+    };
+
+    VertexLayout(int options = Standard);
+
+    int options() const;
+    int stride() const;
+    bool hasTangents() const;
+    const QVector<Attribute>& attributes() const;
+
+    // Dequantization parameters: position = packedPosition * scale + offset
+    QVector3D positionOffset() const;
+    QVector3D positionScale() const;
+    void setPositionRange(QVector3D minPosition, QVector3D maxPosition);
+
+    QByteArray pack(const QVector<Vertex>& vertices) const;
+    QByteArray pack(const VertexAttributes& attributes) const;
+    void pack(const Vertex* vertices, int count, char* dst) const;
+    void pack(const VertexAttributes& attributes, int offset, int count, char* dst) const;
+
+private:
+    int m_options;
+    int m_stride;
+    QVector<Attribute> m_attributes;
+    QVector3D m_positionOffset, m_positionScale;
+
+    void addAttribute(GLuint location, GLint size, GLenum type, GLboolean normalized, int bytes);
+};
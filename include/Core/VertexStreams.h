@@ -0,0 +1,115 @@
+#pragma once
+
+#include <Vertex.h>
+
+// Read-only strided view over one attribute of a vertex array. Views over separate
+// streams are packed (stride == sizeof(T)) and can be walked as plain arrays.
+template <typename T>
+class AttributeView {
+public:
+    AttributeView(): m_data(0), m_stride(int(sizeof(T))), m_count(0) {}
+    AttributeView(const T* data, int stride, int count):
+        m_data(reinterpret_cast<const char*>(data)), m_stride(stride), m_count(count) {}
+
+    int size() const { return m_count; }
+    int stride() const { return m_stride; }
+    bool isPacked() const { return m_stride == int(sizeof(T)); }
+    const T* data() const { return reinterpret_cast<const T*>(m_data); }
+
+    const T& operator[](int i) const {
+        return *reinterpret_cast<const T*>(m_data + ptrdiff_t(i) * m_stride);
+    }
+
+private:
+    const char* m_data;
+    int m_stride, m_count;
+};
+
+// Views over every attribute of a set of vertices, whichever way they are stored
+struct VertexAttributes {
+    AttributeView<QVector3D> positions, normals, tangents, bitangents;
+    AttributeView<QVector2D> texCoords;
+
+    VertexAttributes();
+    VertexAttributes(const Vertex* vertices, int count);
+
+    int size() const;
+    Vertex vertex(int i) const;
+
+    // Interleave `count` vertices starting at `offset` into `dst`
+    void gather(int offset, int count, Vertex* dst) const;
+};
+
+// Array starting on a 32 byte boundary so that SIMD loops can use aligned loads.
+// Elements are copied bytewise and left uninitialized by resize().
+template <typename T>
+class AlignedArray {
+public:
+    enum { Alignment = 32 };
+
+    AlignedArray(): m_data(0), m_size(0) {}
+    explicit AlignedArray(int size): m_data(0), m_size(0) { resize(size); }
+    AlignedArray(const AlignedArray& other): m_data(0), m_size(0) { *this = other; }
+    AlignedArray(AlignedArray&& other): m_data(other.m_data), m_size(other.m_size) {
+        other.m_data = 0;
+        other.m_size = 0;
+    }
+    ~AlignedArray() { qFreeAligned(m_data); }
+
+    AlignedArray& operator=(const AlignedArray& other) {
+        if (this != &other) {
+            resize(other.m_size);
+            if (m_size)
+                memcpy(m_data, other.m_data, size_t(m_size) * sizeof(T));
+        }
+        return *this;
+    }
+    AlignedArray& operator=(AlignedArray&& other) {
+        qSwap(m_data, other.m_data);
+        qSwap(m_size, other.m_size);
+        return *this;
+    }
+
+    int size() const { return m_size; }
+    bool isEmpty() const { return m_size == 0; }
+    T* data() { return m_data; }
+    const T* data() const { return m_data; }
+    const T* constData() const { return m_data; }
+    T& operator[](int i) { return m_data[i]; }
+    const T& operator[](int i) const { return m_data[i]; }
+
+    // Keeps the first min(size, size()) elements
+    void resize(int size) {
+        if (size == m_size) return;
+        T* data = size > 0 ? static_cast<T*>(qMallocAligned(size_t(size) * sizeof(T), Alignment)) : 0;
+        if (size > 0 && !data)
+            qBadAlloc();
+        if (data && m_size)
+            memcpy(data, m_data, size_t(qMin(size, m_size)) * sizeof(T));
+        qFreeAligned(m_data);
+        m_data = data;
+        m_size = qMax(size, 0);
+    }
+    void clear() { resize(0); }
+
+private:
+    T* m_data;
+    int m_size;
+};
+
+// Struct-of-arrays vertex storage, one contiguous aligned stream per attribute
+struct VertexStreams {
+    AlignedArray<QVector3D> positions, normals, tangents, bitangents;
+    AlignedArray<QVector2D> texCoords;
+
+    VertexStreams();
+    VertexStreams(const Vertex* vertices, int count);
+
+    int size() const;
+    void clear();
+    VertexAttributes attributes() const;
+
+    // Overwrite `count` vertices starting at `offset`
+    void scatter(int offset, const Vertex* vertices, int count);
+    QVector<Vertex> interleave() const;
+};
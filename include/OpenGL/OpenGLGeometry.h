@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Mesh.h>
+
+// Vertex array, vertex buffer and index buffer of one mesh geometry. Instances are
+// cached by geometry id and vertex layout, so that meshes holding the same geometry
+// (copies that haven't been written to since) draw from the same buffers.
+class OpenGLGeometry {
+public:
+    // Get the buffers of the current geometry of `mesh`, creating them if needed
+    static OpenGLGeometry* acquire(Mesh* mesh, int layoutOptions);
+    void drop();
+
+    quint64 geometryId() const;
+    int refCount() const;
+    const VertexLayout& layout() const;
+    const AABB& positionRange() const;
+    GLenum indexType() const;
+    int indexSize() const;
+    int vertexCount() const;
+    int indexCount() const;
+    int lodCount() const;
+    int lodOffset(int level) const;
+    int lodIndexCount(int level) const;
+
+    void bind();
+    void release();
+
+    // Refill a vertex range and/or the indices from `mesh`, which must be the only
+    // user of the buffers. They are then keyed on the current geometry of `mesh`.
+    // Returns false without uploading if that geometry already has buffers.
+    bool update(Mesh* mesh, int dirtyBegin, int dirtyEnd, bool indicesDirty);
+
+private:
+    OpenGLGeometry(Mesh* mesh, int layoutOptions);
+    ~OpenGLGeometry();
+
+    quint64 m_geometryId;
+    int m_refCount;
+    VertexLayout m_layout;
+    AABB m_positionRange;
+    GLenum m_indexType;
+    int m_vertexCount, m_indexCount;
+    QVector<int> m_lodOffsets, m_lodCounts; // ranges of the levels in the index buffer
+
+    QOpenGLVertexArrayObject * m_vao;
+    QOpenGLBuffer * m_vbo, *m_ebo;
+
+    static QHash<QPair<quint64, int>, OpenGLGeometry*> m_cache;
+
+    void uploadIndices(Mesh* mesh);
+};
@@ -1,42 +1,73 @@
-#pragma once
-
-#include <Mesh.h>
-#include <OpenGLMaterial.h>
-
-class OpenGLMesh: public QObject {
-    Q_OBJECT
-
-public:
-    OpenGLMesh(Mesh* mesh, QObject* parent = 0);
-    ~OpenGLMesh();
-
-    Mesh* host() const;
-
-    void create();
-    void commit();
-    void render(bool pickingPass = false);
-    void destroy();
-
-    void setSizeFixed(bool sizeFixed);
-    void setPickingID(uint id);
-
-protected:
-    void childEvent(QChildEvent *event) override;
-
-private:
-    Mesh* m_host;
-    bool m_sizeFixed;
-    uint m_pickingID;
-
-    QOpenGLVertexArrayObject * m_vao;
-    QOpenGLBuffer * m_vbo, *m_ebo;
-    QOpenGLFunctions_3_3_Core * glFuncs;
-    OpenGLMaterial *m_openGLMaterial;
-
-    static OpenGLUniformBufferObject *m_modelInfo;
-
-private slots:
-    void materialChanged(Material* material);
-    void geometryChanged(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices);
-    void hostDestroyed(QObject* host);
-};
+#pragma once
+
+#include <OpenGLGeometry.h>
+#include <OpenGLMaterial.h>
+
+class OpenGLMesh: public QObject {
+    Q_OBJECT
+
+public:
+    OpenGLMesh(Mesh* mesh, QObject* parent = 0);
+    ~OpenGLMesh();
+
+    Mesh* host() const;
+
+    void create();
+    void update();
+    void commit(bool instanced = false);
+    int render(bool pickingPass = false); // returns the number of primitives submitted
+    void destroy();
+
+    // Draw the triangles of this mesh once for every mesh of `instances`, which must
+    // share its buffers, level of detail and material. Returns the triangle count.
+    int renderInstanced(const QVector<OpenGLMesh*>& instances, bool pickingPass = false);
+
+    // Buffers drawn by render, 0 until the first update
+    OpenGLGeometry* geometry() const;
+
+    // Level of detail drawn by render, clamped to the levels of the host
+    int lod() const;
+    bool sizeFixed() const;
+
+    void setSizeFixed(bool sizeFixed);
+    void setPickingID(uint id);
+    void setLod(int level);
+
+    // Camera used to cull the meshlets of the host, off-screen and back-facing
+    // clusters are skipped and the rest is drawn in as few ranges as possible
+    void setCullingView(const QMatrix4x4& projViewMat, QVector3D viewPos);
+
+protected:
+    void childEvent(QChildEvent *event) override;
+
+private:
+    Mesh* m_host;
+    bool m_sizeFixed;
+    uint m_pickingID;
+    int m_lod;
+    bool m_cullingEnabled;
+    QMatrix4x4 m_projViewMat;
+    QVector3D m_viewPos;
+    int m_dirtyBegin, m_dirtyEnd; // vertex range waiting to be uploaded
+    bool m_indicesDirty;
+
+    OpenGLGeometry * m_geometry; // possibly shared with other meshes
+    QOpenGLFunctions_3_3_Core * glFuncs;
+    OpenGLMaterial *m_openGLMaterial;
+
+    static OpenGLUniformBufferObject *m_modelInfo;
+    static QOpenGLBuffer *m_instanceBuffer;
+
+    int resolveVertexLayout() const;
+    bool positionRangeChanged() const;
+    int drawMeshlets(bool coneCulling);
+
+private slots:
+    void materialChanged(Material* material);
+    void geometryChanged(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices);
+    void verticesUpdated(int offset, int count);
+    void lodsChanged();
+    void meshletsChanged();
+    void vertexLayoutChanged(int options);
+    void hostDestroyed(QObject* host);
+};
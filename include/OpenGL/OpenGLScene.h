@@ -1,40 +1,65 @@
-#pragma once
-
-#include <Scene.h>
-#include <OpenGLMesh.h>
-#include <OpenGLUniformBufferObject.h>
-
-class OpenGLScene: public QObject {
-    Q_OBJECT
-
-public:
-    OpenGLScene(Scene* scene);
-
-    Scene* host() const;
-
-    OpenGLMesh* pick(uint32_t pickingID);
-
-    void renderAxis();
-    void renderGridlines();
-    void renderLights();
-    void renderModels(bool pickingPass = false);
-
-    void commitCameraInfo();
-    void commitLightInfo();
-
-protected:
-    void childEvent(QChildEvent *event) override;
-
-private:
-    Scene* m_host;
-    QVector<OpenGLMesh*> m_gizmoMeshes, m_gridlineMeshes, m_lightMeshes, m_normalMeshes;
-    static OpenGLUniformBufferObject *m_cameraInfo, *m_lightInfo;
-
-private slots:
-    void gizmoAdded(AbstractGizmo* gizmo);
-    void gridlineAdded(Gridline* gridline);
-    void lightAdded(AbstractLight* light);
-    void modelAdded(Model* model);
-    void meshAdded(Mesh* mesh);
-    void hostDestroyed(QObject* host);
-};
+#pragma once
+
+#include <Scene.h>
+#include <OpenGLMesh.h>
+#include <OpenGLUniformBufferObject.h>
+
+class OpenGLScene: public QObject {
+    Q_OBJECT
+
+public:
+    OpenGLScene(Scene* scene);
+
+    Scene* host() const;
+
+    OpenGLMesh* pick(uint32_t pickingID);
+
+    // Resolve a world space ray on the CPU against the gizmo, the light markers and
+    // the models, in the order the picking pass would let them win
+    OpenGLMesh* pick(const Line& ray, RayHit* hit = 0);
+
+    // Whether a model has line or point meshes, which have no area for pick() to
+    // hit and are only found by the picking pass
+    bool hasLineOrPointMeshes() const;
+
+    void renderAxis();
+    void renderGridlines();
+    void renderLights(bool pickingPass = false);
+    void renderModels(bool pickingPass = false);
+
+    // Triangles of the models drawn by the last non-picking pass
+    int submittedTriangles() const;
+
+    // Models and light markers tested against the view frustum by the last
+    // non-picking pass, and how many of them were left out
+    int testedObjects() const;
+    int culledObjects() const;
+
+    void commitCameraInfo();
+    void commitLightInfo();
+
+protected:
+    void childEvent(QChildEvent *event) override;
+
+private:
+    Scene* m_host;
+    QVector<OpenGLMesh*> m_gizmoMeshes, m_gridlineMeshes, m_lightMeshes, m_normalMeshes;
+    QHash<Mesh*, OpenGLMesh*> m_meshMap; // hosts of m_normalMeshes
+    int m_submittedTriangles;
+    int m_testedModels, m_culledModels, m_testedLights, m_culledLights;
+    static OpenGLUniformBufferObject *m_cameraInfo, *m_lightInfo;
+
+    void renumberNormalMeshes();
+    void selectLod(OpenGLMesh* openGLMesh);
+    QMatrix4x4 modelMatrix(OpenGLMesh* openGLMesh) const;
+    bool raycast(OpenGLMesh* openGLMesh, const Line& ray, RayHit& hit, float maxDistance) const;
+    bool isInstanceable(OpenGLMesh* openGLMesh, bool pickingPass) const;
+
+private slots:
+    void gizmoAdded(AbstractGizmo* gizmo);
+    void gridlineAdded(Gridline* gridline);
+    void lightAdded(AbstractLight* light);
+    void modelAdded(Model* model);
+    void meshAdded(Mesh* mesh);
+    void hostDestroyed(QObject* host);
+};
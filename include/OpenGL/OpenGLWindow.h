@@ -1,52 +1,83 @@
-#pragma once
-
-#include <OpenGLScene.h>
-#include <OpenGLRenderer.h>
-#include <FPSCounter.h>
-
-class OpenGLWindow: public QOpenGLWindow, protected QOpenGLFunctions_3_3_Core {
-    Q_OBJECT
-
-public:
-    OpenGLWindow();
-    OpenGLWindow(OpenGLScene* openGLScene, OpenGLRenderer* renderer);
-
-    QString rendererName();
-    QString openGLVersion();
-    QString shadingLanguageVersion();
-
-    void setScene(OpenGLScene* openGLScene);
-    void setRenderer(OpenGLRenderer* renderer);
-    void setEnableMousePicking(bool enabled);
-    void setCustomRenderingLoop(void (*customRenderingLoop)(Scene*));
-
-protected:
-    void initializeGL() override;
-    void paintGL() override;
-    bool event(QEvent *ev) override;
-    void keyPressEvent(QKeyEvent *event) override;
-    void keyReleaseEvent(QKeyEvent *event) override;
-    void mousePressEvent(QMouseEvent *event) override;
-    void mouseReleaseEvent(QMouseEvent *event) override;
-    void wheelEvent(QWheelEvent *event) override;
-    void focusOutEvent(QFocusEvent *event) override;
-
-signals:
-    void fpsChanged(int fps);
-
-private:
-    QHash<int, bool> m_keyPressed;
-    QPoint m_lastCursorPos;
-    QTime m_lastMousePressTime;
-    bool m_enableMousePicking;
-    OpenGLScene* m_openGLScene;
-    OpenGLRenderer * m_renderer;
-    FPSCounter* m_fpsCounter;
-    void (*m_customRenderingLoop)(Scene*);
-
-    void processUserInput();
-    void configSignals();
-
-private slots:
-    void sceneDestroyed(QObject* host);
-};
+#pragma once
+
+#include <OpenGLScene.h>
+#include <OpenGLRenderer.h>
+#include <FPSCounter.h>
+#include <ModelLoader.h>
+
+class OpenGLWindow: public QOpenGLWindow, protected QOpenGLFunctions_3_3_Core {
+    Q_OBJECT
+
+public:
+    OpenGLWindow();
+    OpenGLWindow(OpenGLScene* openGLScene, OpenGLRenderer* renderer);
+    ~OpenGLWindow();
+
+    QString rendererName();
+    QString openGLVersion();
+    QString shadingLanguageVersion();
+    int submittedTriangles();
+    int testedObjects();
+    int culledObjects();
+
+    // Triangle, barycentrics and world point under the cursor, distance is inf if none
+    const RayHit& hoverHit() const;
+
+    void setScene(OpenGLScene* openGLScene);
+    void setRenderer(OpenGLRenderer* renderer);
+    void setEnableMousePicking(bool enabled);
+    void setCustomRenderingLoop(void (*customRenderingLoop)(Scene*));
+
+    // Import in the background, the model is added to the scene shown when it's done
+    void importModel(QString filePath);
+    void cancelImports();
+
+    // Profile of the imports started from now on
+    ModelLoader::ImportProfile importProfile() const;
+    void setImportProfile(ModelLoader::ImportProfile profile);
+    bool enableNativeReaders() const;
+    void setEnableNativeReaders(bool enabled);
+    int meshOptimization() const;
+    void setMeshOptimization(int options);
+    Mesh::StorageMode storageMode() const;
+    void setStorageMode(Mesh::StorageMode storageMode);
+
+    // Average progress of the running imports in percent, -1 if there are none
+    int importProgress() const;
+
+protected:
+    void initializeGL() override;
+    void paintGL() override;
+    bool event(QEvent *ev) override;
+    void keyPressEvent(QKeyEvent *event) override;
+    void keyReleaseEvent(QKeyEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void wheelEvent(QWheelEvent *event) override;
+    void focusOutEvent(QFocusEvent *event) override;
+
+signals:
+    void fpsChanged(int fps);
+    // One line about a finished import, worth showing in the status bar
+    void importReported(QString report);
+
+private:
+    QHash<int, bool> m_keyPressed;
+    QPoint m_lastCursorPos;
+    QTime m_lastMousePressTime;
+    bool m_enableMousePicking;
+    RayHit m_hoverHit;
+    OpenGLScene* m_openGLScene;
+    OpenGLRenderer * m_renderer;
+    FPSCounter* m_fpsCounter;
+    ModelLoader m_modelLoader;
+    QVector<QFutureWatcher<Model*>*> m_imports;
+    void (*m_customRenderingLoop)(Scene*);
+
+    void processUserInput();
+    void configSignals();
+
+private slots:
+    void sceneDestroyed(QObject* host);
+    void importFinished();
+};
@@ -1,28 +1,40 @@
-#pragma once
-
-#include <Mesh.h>
-#include <Vector3DEditSlider.h>
-
-class MeshProperty: public QWidget {
-    Q_OBJECT
-
-public:
-    MeshProperty(Mesh * mesh, QWidget * parent = 0);
-
-private:
-    Mesh *m_host;
-    QCheckBox *m_visibleCheckBox, *m_wireFrameModeCheckBox;
-    QLabel *m_meshTypeTextLabel, *m_meshTypeValueLabel;
-    QLabel *m_numOfVerticesTextLabel, *m_numOfVerticesValueLabel;
-    QLabel *m_numOfFacesTextLabel, *m_numOfFacesValueLabel;
-    Vector3DEdit *m_positionEdit, *m_scalingEdit;
-    Vector3DEditSlider *m_rotationEditSlider;
-
-    void configLayout();
-    void configSignals();
-
-private slots:
-    void hostDestroyed(QObject* host);
-    void meshTypeChanged(int meshType);
-    void geometryChanged(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices);
-};
+#pragma once
+
+#include <MeshSimplifier.h>
+#include <MeshOptimizer.h>
+#include <Vector3DEditSlider.h>
+
+class MeshProperty: public QWidget {
+    Q_OBJECT
+
+public:
+    MeshProperty(Mesh * mesh, QWidget * parent = 0);
+
+private:
+    Mesh *m_host;
+    QCheckBox *m_visibleCheckBox, *m_wireFrameModeCheckBox;
+    QLabel *m_meshTypeTextLabel, *m_meshTypeValueLabel;
+    QLabel *m_numOfVerticesTextLabel, *m_numOfVerticesValueLabel;
+    QLabel *m_vertexLayoutTextLabel;
+    QComboBox *m_vertexLayoutComboBox;
+    QLabel *m_numOfFacesTextLabel, *m_numOfFacesValueLabel;
+    QLabel *m_numOfLodsTextLabel, *m_numOfLodsValueLabel;
+    QLabel *m_numOfMeshletsTextLabel, *m_numOfMeshletsValueLabel;
+    QPushButton *m_generateLodsButton, *m_buildMeshletsButton;
+    Vector3DEdit *m_positionEdit, *m_scalingEdit;
+    Vector3DEditSlider *m_rotationEditSlider;
+
+    void configLayout();
+    void configSignals();
+
+private slots:
+    void hostDestroyed(QObject* host);
+    void meshTypeChanged(int meshType);
+    void vertexLayoutChanged(int options);
+    void vertexLayoutSelected(int index);
+    void geometryChanged(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices);
+    void lodsChanged();
+    void generateLods();
+    void meshletsChanged();
+    void buildMeshlets();
+};
@@ -3,6 +3,7 @@ out vec4 fragColor;
 in vec3 fragPos;
 in vec2 fragTexCoords;
 in mat3 TBN;
+flat in int fragFlags;
 
 uniform sampler2D diffuseMap;
 uniform sampler2D specularMap;
@@ -82,9 +83,9 @@ void main() {
     for (int i = 0; i < spotLightNum; i++)
         fragColor += vec4(calcSpotLight(i, normal, color, material.diffuse, spec), 1);
 
-    if (highlighted == 1)
+    if ((fragFlags & HIGHLIGHTED) != 0)
         fragColor += vec4(0.2, 0.2, 0.2, 0);
 
-    if (selected == 1)
+    if ((fragFlags & SELECTED) != 0)
         fragColor += vec4(0, 0, 0.4, 0);
 }
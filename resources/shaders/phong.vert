@@ -1,26 +1,49 @@
-layout (location = 0) in vec3 position;
-layout (location = 1) in vec3 normal;
-layout (location = 2) in vec3 tangent;
-layout (location = 3) in vec3 bitangent;
-layout (location = 4) in vec2 texCoords;
-
-out vec3 fragPos;
-out vec2 fragTexCoords;
-out mat3 TBN;
-
-void main() {
-    vec3 T = normalize(mat3(modelMat) * tangent);
-    vec3 B = normalize(mat3(modelMat) * bitangent);
-    vec3 N = normalize(mat3(normalMat) * normal);
-    
-    fragPos = vec3(modelMat * vec4(position, 1.0f));
-    fragTexCoords = texCoords;
-    TBN = mat3(T, B, N);
-
-    mat4 MVP = projMat * viewMat * modelMat;
-    gl_Position = MVP * vec4(position, 1.0f);
-    if (sizeFixed == 1) {
-        float w = (MVP * vec4(0.0f, 0.0f, 0.0f, 1.0f)).w / 100;
-        gl_Position = MVP * vec4(position * w, 1.0f);
-    }
-}
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec4 tangent;
+layout (location = 3) in vec3 bitangent;
+layout (location = 4) in vec2 texCoords;
+layout (location = 5) in mat4 instanceModelMat;
+layout (location = 9) in mat3 instanceNormalMat;
+layout (location = 12) in uvec2 instanceInfo; // picking ID, flags
+
+out vec3 fragPos;
+out vec2 fragTexCoords;
+out mat3 TBN;
+flat out int fragFlags;
+
+void main() {
+    vec3 pos = position * vec3(positionScale) + vec3(positionOffset);
+    vec3 n = (vertexLayout & OCTAHEDRAL_NORMALS) != 0 ? octDecode(normal.xy) : normal;
+    mat4 model = instanced == 1 ? instanceModelMat : modelMat;
+
+    vec3 N = normalize((instanced == 1 ? instanceNormalMat : mat3(normalMat)) * n);
+    vec3 T, B;
+    if ((vertexLayout & NO_TANGENTS) != 0) {
+        // No tangent frame is stored, build an arbitrary one around N
+        T = normalize(cross(abs(N.y) < 0.99f ? vec3(0, 1, 0) : vec3(1, 0, 0), N));
+        B = cross(T, N);
+    } else if ((vertexLayout & PACKED_TANGENTS) != 0) {
+        // Rebuild the bitangent from the tangent handedness
+        T = normalize(mat3(model) * tangent.xyz);
+        B = cross(T, N) * (tangent.w < 0.0f ? -1.0f : 1.0f);
+    } else {
+        T = normalize(mat3(model) * tangent.xyz);
+        B = normalize(mat3(model) * bitangent);
+    }
+
+    fragPos = vec3(model * vec4(pos, 1.0f));
+    fragTexCoords = texCoords;
+    TBN = mat3(T, B, N);
+    if (instanced == 1)
+        fragFlags = int(instanceInfo.y);
+    else
+        fragFlags = (highlighted == 1 ? HIGHLIGHTED : 0) | (selected == 1 ? SELECTED : 0);
+
+    mat4 MVP = projMat * viewMat * model;
+    gl_Position = MVP * vec4(pos, 1.0f);
+    if (sizeFixed == 1) {
+        float w = (MVP * vec4(0.0f, 0.0f, 0.0f, 1.0f)).w / 100;
+        gl_Position = MVP * vec4(pos * w, 1.0f);
+    }
+}
@@ -0,0 +1,258 @@
+#include <BVH.h>
+#include <QVarLengthArray>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define BVH_USE_SSE
+#endif
+
+static const int binCount = 16;
+
+// Relative cost of visiting an inner node against testing one primitive
+static const float traversalCost = 1.0f;
+
+static inline float reciprocal(float v) {
+    return qAbs(v) > FLT_MIN ? 1.0f / v : FLT_MAX;
+}
+
+static inline float halfArea(const AABB& box) {
+    if (box.isEmpty()) return 0.0f;
+    QVector3D d = box.maximum - box.minimum;
+    return d.x() * d.y() + d.y() * d.z() + d.z() * d.x();
+}
+
+Ray::Ray() {}
+
+Ray::Ray(QVector3D _origin, QVector3D _direction): origin(_origin), direction(_direction) {
+    invDirection = QVector3D(reciprocal(direction.x()), reciprocal(direction.y()), reciprocal(direction.z()));
+}
+
+Ray::Ray(const Line & line): Ray(line.st, line.dir) {}
+
+RayHit::RayHit() {
+    distance = inf;
+    triangle = -1;
+    barycentric = QVector2D(0, 0);
+    point = QVector3D(0, 0, 0);
+}
+
+BVH::BVH() {}
+
+struct BuildTask {
+    int begin, end;
+    int parent; // inner node whose right child this is, -1 for the root and left children
+};
+
+struct Bin {
+    AABB bounds;
+    int count;
+};
+
+// Whether a primitive falls left of a bin boundary
+struct BinLess {
+    const QVector3D* centroids;
+    int axis, bin;
+    float minimum, scale;
+
+    bool operator()(int primitive) const {
+        return qMin(binCount - 1, int((centroids[primitive][axis] - minimum) * scale)) < bin;
+    }
+};
+
+void BVH::build(const QVector<AABB>& boxes, int maxLeafSize) {
+    clear();
+    if (boxes.isEmpty()) return;
+
+    QVector<QVector3D> centroids(boxes.size());
+    m_primitives.resize(boxes.size());
+    for (int i = 0; i < boxes.size(); i++) {
+        centroids[i] = boxes[i].center();
+        m_primitives[i] = i;
+    }
+    m_nodes.reserve(boxes.size() * 2);
+
+    QVector<BuildTask> stack;
+    BuildTask root = { 0, boxes.size(), -1 };
+    stack.push_back(root);
+    while (!stack.isEmpty()) {
+        BuildTask task = stack.back();
+        stack.pop_back();
+
+        int nodeIndex = m_nodes.size();
+        if (task.parent >= 0)
+            m_nodes[task.parent].first = nodeIndex;
+
+        AABB bounds, centroidBounds;
+        for (int i = task.begin; i < task.end; i++) {
+            bounds.merge(boxes[m_primitives[i]]);
+            centroidBounds.merge(centroids[m_primitives[i]]);
+        }
+        Node node;
+        for (int k = 0; k < 3; k++) {
+            node.minimum[k] = bounds.minimum[k];
+            node.maximum[k] = bounds.maximum[k];
+        }
+        node.minimum[3] = 0.0f;
+        node.maximum[3] = FLT_MAX;
+        node.first = task.begin;
+        node.count = task.end - task.begin;
+        m_nodes.push_back(node);
+
+        int count = task.end - task.begin;
+        if (count <= maxLeafSize) continue;
+
+        // Cheapest split plane among the bin boundaries of all three axes
+        QVector3D extent = centroidBounds.maximum - centroidBounds.minimum;
+        float bestCost = FLT_MAX;
+        int bestAxis = -1, bestBin = 0;
+        for (int axis = 0; axis < 3; axis++) {
+            if (extent[axis] < FLT_MIN) continue;
+            Bin bins[binCount];
+            for (int b = 0; b < binCount; b++)
+                bins[b].count = 0;
+            float scale = binCount / extent[axis];
+            for (int i = task.begin; i < task.end; i++) {
+                int b = qMin(binCount - 1, int((centroids[m_primitives[i]][axis] - centroidBounds.minimum[axis]) * scale));
+                bins[b].count++;
+                bins[b].bounds.merge(boxes[m_primitives[i]]);
+            }
+
+            float rightArea[binCount];
+            int rightCount[binCount];
+            AABB right;
+            int countRight = 0;
+            for (int b = binCount - 1; b > 0; b--) {
+                right.merge(bins[b].bounds);
+                countRight += bins[b].count;
+                rightArea[b] = halfArea(right);
+                rightCount[b] = countRight;
+            }
+            AABB left;
+            int countLeft = 0;
+            for (int b = 1; b < binCount; b++) {
+                left.merge(bins[b - 1].bounds);
+                countLeft += bins[b - 1].count;
+                if (countLeft == 0 || rightCount[b] == 0) continue;
+                float cost = halfArea(left) * countLeft + rightArea[b] * rightCount[b];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = b;
+                }
+            }
+        }
+
+        int middle;
+        if (bestAxis >= 0) {
+            // Keep the node as a leaf if splitting isn't expected to pay off
+            float parentArea = halfArea(bounds);
+            if (count <= maxLeafSize * 4 && parentArea > 0.0f && traversalCost + bestCost / parentArea >= count)
+                continue;
+            BinLess less = { centroids.constData(), bestAxis, bestBin,
+                             centroidBounds.minimum[bestAxis], binCount / extent[bestAxis] };
+            int* split = std::partition(m_primitives.begin() + task.begin, m_primitives.begin() + task.end, less);
+            middle = int(split - m_primitives.begin());
+        } else {
+            // All centroids coincide, cut the range in half to bound the leaf size
+            middle = (task.begin + task.end) / 2;
+        }
+
+        m_nodes[nodeIndex].count = 0;
+        BuildTask rightTask = { middle, task.end, nodeIndex };
+        BuildTask leftTask = { task.begin, middle, -1 };
+        stack.push_back(rightTask);
+        stack.push_back(leftTask); // popped next, so it lands right after its parent
+    }
+
+    m_nodes.squeeze();
+}
+
+void BVH::clear() {
+    m_nodes.clear();
+    m_primitives.clear();
+}
+
+bool BVH::isEmpty() const {
+    return m_nodes.isEmpty();
+}
+
+AABB BVH::bounds() const {
+    if (m_nodes.isEmpty()) return AABB();
+    const Node& root = m_nodes[0];
+    return AABB(QVector3D(root.minimum[0], root.minimum[1], root.minimum[2]),
+                QVector3D(root.maximum[0], root.maximum[1], root.maximum[2]));
+}
+
+const QVector<BVH::Node>& BVH::nodes() const {
+    return m_nodes;
+}
+
+const QVector<int>& BVH::primitives() const {
+    return m_primitives;
+}
+
+struct TraversalEntry {
+    int node;
+    float entry;
+};
+
+void BVH::raycast(const Ray & ray, float maxDistance, RayVisitor & visitor) const {
+    if (m_nodes.isEmpty()) return;
+    TraversalEntry root = { 0, 0.0f };
+    if (!intersects(m_nodes[0], ray, maxDistance, root.entry)) return;
+
+    QVarLengthArray<TraversalEntry, 64> stack;
+    stack.append(root);
+    while (!stack.isEmpty()) {
+        TraversalEntry current = stack.last();
+        stack.removeLast();
+        if (current.entry > maxDistance) continue; // a closer hit was found meanwhile
+
+        const Node& node = m_nodes[current.node];
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; i++)
+                visitor.visit(m_primitives[i], maxDistance);
+            continue;
+        }
+
+        TraversalEntry left = { current.node + 1, 0.0f }, right = { node.first, 0.0f };
+        bool hitLeft = intersects(m_nodes[left.node], ray, maxDistance, left.entry);
+        bool hitRight = intersects(m_nodes[right.node], ray, maxDistance, right.entry);
+        // Push the farther child first so that the nearer one is visited next
+        if (hitLeft && hitRight) {
+            stack.append(left.entry < right.entry ? right : left);
+            stack.append(left.entry < right.entry ? left : right);
+        } else if (hitLeft)
+            stack.append(left);
+        else if (hitRight)
+            stack.append(right);
+    }
+}
+
+bool BVH::intersects(const Node & node, const Ray & ray, float maxDistance, float & entry) {
+#ifdef BVH_USE_SSE
+    // The fourth lane spans [0, FLT_MAX] and clamps the entry distance at 0
+    __m128 origin = _mm_setr_ps(ray.origin.x(), ray.origin.y(), ray.origin.z(), 0.0f);
+    __m128 invDirection = _mm_setr_ps(ray.invDirection.x(), ray.invDirection.y(), ray.invDirection.z(), 1.0f);
+    __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.minimum), origin), invDirection);
+    __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.maximum), origin), invDirection);
+    __m128 tNear = _mm_min_ps(t0, t1);
+    __m128 tFar = _mm_max_ps(t0, t1);
+    tNear = _mm_max_ps(tNear, _mm_shuffle_ps(tNear, tNear, _MM_SHUFFLE(2, 3, 0, 1)));
+    tNear = _mm_max_ps(tNear, _mm_shuffle_ps(tNear, tNear, _MM_SHUFFLE(1, 0, 3, 2)));
+    tFar = _mm_min_ps(tFar, _mm_shuffle_ps(tFar, tFar, _MM_SHUFFLE(2, 3, 0, 1)));
+    tFar = _mm_min_ps(tFar, _mm_shuffle_ps(tFar, tFar, _MM_SHUFFLE(1, 0, 3, 2)));
+    entry = _mm_cvtss_f32(tNear);
+    return entry <= qMin(_mm_cvtss_f32(tFar), maxDistance);
+#else
+    float tNear = 0.0f, tFar = maxDistance;
+    for (int k = 0; k < 3; k++) {
+        float t0 = (node.minimum[k] - ray.origin[k]) * ray.invDirection[k];
+        float t1 = (node.maximum[k] - ray.origin[k]) * ray.invDirection[k];
+        tNear = qMax(tNear, qMin(t0, t1));
+        tFar = qMin(tFar, qMax(t0, t1));
+    }
+    entry = tNear;
+    return tNear <= tFar;
+#endif
+}
@@ -0,0 +1,54 @@
+#include <FrustumCuller.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define CULLER_USE_SSE
+#endif
+
+FrustumCuller::FrustumCuller(const Frustum & frustum): m_frustum(frustum) {}
+
+bool FrustumCuller::isVisible(const AABB & box) const {
+    return m_frustum.intersects(box);
+}
+
+int FrustumCuller::cull(const AABB * boxes, int count, QVector<int>& visible) const {
+    int first = visible.size();
+    int i = 0;
+
+#ifdef CULLER_USE_SSE
+    for (; i + 4 <= count; i += 4) {
+        // Transpose four boxes into one register per bound component
+        __m128 minimum[3], maximum[3];
+        for (int k = 0; k < 3; k++) {
+            minimum[k] = _mm_setr_ps(boxes[i].minimum[k], boxes[i + 1].minimum[k], boxes[i + 2].minimum[k], boxes[i + 3].minimum[k]);
+            maximum[k] = _mm_setr_ps(boxes[i].maximum[k], boxes[i + 1].maximum[k], boxes[i + 2].maximum[k], boxes[i + 3].maximum[k]);
+        }
+
+        // Empty boxes have a minimum above the maximum on some axis
+        __m128 outside = _mm_or_ps(_mm_or_ps(_mm_cmpgt_ps(minimum[0], maximum[0]), _mm_cmpgt_ps(minimum[1], maximum[1])),
+                                   _mm_cmpgt_ps(minimum[2], maximum[2]));
+        for (int p = 0; p < 6; p++) {
+            const QVector4D& plane = m_frustum.planes[p];
+            // The corner furthest along the plane normal, chosen per plane for all boxes
+            __m128 x = plane.x() >= 0 ? maximum[0] : minimum[0];
+            __m128 y = plane.y() >= 0 ? maximum[1] : minimum[1];
+            __m128 z = plane.z() >= 0 ? maximum[2] : minimum[2];
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.x())), _mm_mul_ps(y, _mm_set1_ps(plane.y()))),
+                                         _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(plane.z())), _mm_set1_ps(plane.w())));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_setzero_ps()));
+        }
+
+        int mask = _mm_movemask_ps(outside);
+        if (mask == 0xF) continue;
+        for (int j = 0; j < 4; j++)
+            if (!(mask & (1 << j)))
+                visible.push_back(i + j);
+    }
+#endif
+
+    for (; i < count; i++)
+        if (m_frustum.intersects(boxes[i]))
+            visible.push_back(i);
+
+    return visible.size() - first;
+}
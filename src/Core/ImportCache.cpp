@@ -0,0 +1,223 @@
+#include <ImportCache.h>
+
+// Bumped whenever the layout of the entries changes
+static const char* cacheFormat = "AshEngine import cache 2";
+
+static const qint64 defaultMaxSize = qint64(1) << 30;
+
+// Source files are hashed in pieces of this size
+static const int digestChunkSize = 1 << 20;
+
+// Partial lines longer than this aren't carried into the next piece, they can't
+// name a material library
+static const int maxReferenceLine = 4096;
+
+// Material libraries named by the lines of `text` starting before `limit`. The
+// text always starts at the beginning of a line.
+static void findMaterialLibraries(const QByteArray& text, int limit, const QDir& dir, QStringList& references) {
+    for (int i = text.indexOf("mtllib"); i >= 0 && i < limit; i = text.indexOf("mtllib", i + 6)) {
+        int start = i;
+        while (start > 0 && (text[start - 1] == ' ' || text[start - 1] == '\t'))
+            start--;
+        if (start > 0 && text[start - 1] != '\n') continue;
+        int end = text.indexOf('\n', i);
+        if (end < 0) end = text.size();
+        if (i + 6 >= end || (text[i + 6] != ' ' && text[i + 6] != '\t')) continue;
+        QString name = QString::fromUtf8(text.mid(i + 6, end - i - 6).trimmed());
+        QString path = dir.absoluteFilePath(name);
+        if (!name.isEmpty() && !references.contains(path))
+            references.push_back(path);
+    }
+}
+
+ImportCache::Entry::Entry(QString filePath): m_file(filePath), m_data(0) {
+    if (m_file.open(QIODevice::ReadOnly) && m_file.size() > 0)
+        m_data = m_file.map(0, m_file.size());
+}
+
+ImportCache::Entry::~Entry() {
+    if (m_data) m_file.unmap(m_data);
+}
+
+bool ImportCache::Entry::isValid() const {
+    return m_data != 0;
+}
+
+const uchar * ImportCache::Entry::data() const {
+    return m_data;
+}
+
+qint64 ImportCache::Entry::size() const {
+    return m_data ? m_file.size() : 0;
+}
+
+QByteArray ImportCache::Entry::bytes() const {
+    return QByteArray::fromRawData(reinterpret_cast<const char*>(m_data), int(size()));
+}
+
+ImportCache * ImportCache::instance() {
+    static ImportCache cache;
+    return &cache;
+}
+
+ImportCache::ImportCache() {
+    m_enabled = true;
+    m_directory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/imports";
+    m_maxSize = defaultMaxSize;
+}
+
+bool ImportCache::enabled() const {
+    QMutexLocker locker(&m_mutex);
+    return m_enabled;
+}
+
+void ImportCache::setEnabled(bool enabled) {
+    QMutexLocker locker(&m_mutex);
+    m_enabled = enabled;
+}
+
+QString ImportCache::directory() const {
+    QMutexLocker locker(&m_mutex);
+    return m_directory;
+}
+
+void ImportCache::setDirectory(QString directory) {
+    QMutexLocker locker(&m_mutex);
+    m_directory = directory;
+}
+
+qint64 ImportCache::maxSize() const {
+    QMutexLocker locker(&m_mutex);
+    return m_maxSize;
+}
+
+void ImportCache::setMaxSize(qint64 maxSize) {
+    m_mutex.lock();
+    m_maxSize = maxSize;
+    m_mutex.unlock();
+    evict();
+}
+
+QString ImportCache::key(QString filePath, const QByteArray & options) {
+    if (!enabled()) return QString();
+
+    SourceDigest source;
+    if (!digest(filePath, source)) return QString();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(cacheFormat);
+    hash.addData(source.contents);
+    hash.addData(QByteArray::number(source.modified));
+    hash.addData(options);
+
+    // A missing library counts too, the model looks different once it shows up
+    for (int i = 0; i < source.references.size(); i++) {
+        SourceDigest reference;
+        hash.addData(source.references[i].toUtf8());
+        if (digest(source.references[i], reference)) {
+            hash.addData(reference.contents);
+            hash.addData(QByteArray::number(reference.modified));
+        } else
+            hash.addData("missing");
+    }
+    return hash.result().toHex();
+}
+
+bool ImportCache::digest(QString filePath, SourceDigest & digest) {
+    QFileInfo info(filePath);
+    if (!info.isFile()) return false;
+    digest.size = info.size();
+    digest.modified = info.lastModified().toMSecsSinceEpoch();
+
+    // The digest of an unchanged file is read back instead of hashing it again
+    QString digestKey = QCryptographicHash::hash(
+        (QString(cacheFormat) + " digest " + info.absoluteFilePath()).toUtf8(), QCryptographicHash::Sha1).toHex();
+    if (QSharedPointer<Entry> entry = find(digestKey)) {
+        QDataStream in(entry->bytes());
+        qint64 size, modified;
+        in >> size >> modified >> digest.contents >> digest.references;
+        if (in.status() == QDataStream::Ok && size == digest.size && modified == digest.modified)
+            return true;
+    }
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) return false;
+    QCryptographicHash contents(QCryptographicHash::Sha1);
+    bool obj = info.suffix().toLower() == "obj";
+    QByteArray text; // the partial last line of the previous piece, then the current piece
+    digest.references.clear();
+    while (!file.atEnd()) {
+        QByteArray piece = file.read(digestChunkSize);
+        if (piece.isEmpty()) return false;
+        contents.addData(piece);
+        if (!obj) continue;
+
+        text += piece;
+        int lineStart = text.lastIndexOf('\n') + 1;
+        findMaterialLibraries(text, file.atEnd() ? text.size() : lineStart, info.absoluteDir(), digest.references);
+        text = text.mid(lineStart);
+        if (text.size() > maxReferenceLine)
+            text = "#"; // keeps the rest of the long line from being read as a new one
+    }
+    digest.contents = contents.result();
+
+    QByteArray bytes;
+    QDataStream(&bytes, QIODevice::WriteOnly) << digest.size << digest.modified << digest.contents << digest.references;
+    insert(digestKey, bytes);
+    return true;
+}
+
+QSharedPointer<ImportCache::Entry> ImportCache::find(QString key) {
+    if (key.isEmpty()) return QSharedPointer<Entry>();
+
+    QMutexLocker locker(&m_mutex);
+    QString filePath = m_directory + '/' + key;
+    if (!QFileInfo::exists(filePath)) return QSharedPointer<Entry>();
+
+    QSharedPointer<Entry> entry(new Entry(filePath));
+    if (!entry->isValid()) return QSharedPointer<Entry>();
+
+    // The modification time orders the entries for eviction
+    QFile file(filePath);
+    if (file.open(QIODevice::ReadWrite))
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Import cache hit" << key;
+    return entry;
+}
+
+bool ImportCache::insert(QString key, const QByteArray & data) {
+    if (key.isEmpty()) return false;
+
+    m_mutex.lock();
+    QString directory = m_directory;
+    m_mutex.unlock();
+
+    // Readers never see a partly written entry
+    QDir().mkpath(directory);
+    QSaveFile file(directory + '/' + key);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+        if (log_level >= LOG_LEVEL_WARNING)
+            dout << "Failed to write import cache entry" << key << ":" << file.errorString();
+        return false;
+    }
+
+    evict();
+    return true;
+}
+
+void ImportCache::evict() {
+    QMutexLocker locker(&m_mutex);
+    QFileInfoList entries = QDir(m_directory).entryInfoList(QDir::Files, QDir::Time); // newest first
+    qint64 size = 0;
+    for (int i = 0; i < entries.size(); i++)
+        size += entries[i].size();
+
+    for (int i = entries.size() - 1; i >= 0 && size > m_maxSize; i--)
+        if (QFile::remove(entries[i].absoluteFilePath())) {
+            size -= entries[i].size();
+            if (log_level >= LOG_LEVEL_INFO)
+                dout << "Evicted import cache entry" << entries[i].fileName();
+        }
+}
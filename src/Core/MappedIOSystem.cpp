@@ -0,0 +1,99 @@
+#include <MappedIOSystem.h>
+
+MappedIOStream::MappedIOStream(QFile * file, const uchar * data, size_t size):
+    m_file(file), m_data(data), m_size(size), m_position(0) {}
+
+MappedIOStream::MappedIOStream(const QByteArray & bytes):
+    m_file(0), m_bytes(bytes), m_position(0) {
+    m_data = reinterpret_cast<const uchar*>(m_bytes.constData());
+    m_size = size_t(m_bytes.size());
+}
+
+MappedIOStream::~MappedIOStream() {
+    delete m_file; // unmaps
+}
+
+size_t MappedIOStream::Read(void * buffer, size_t size, size_t count) {
+    if (size == 0 || count == 0) return 0;
+    // Only whole elements are read, as fread does
+    size_t available = (m_size - m_position) / size;
+    if (count > available) count = available;
+    memcpy(buffer, m_data + m_position, size * count);
+    m_position += size * count;
+    return count;
+}
+
+size_t MappedIOStream::Write(const void *, size_t, size_t) {
+    return 0;
+}
+
+// Same offset conventions as Assimp's memory streams, positive distances from the end
+aiReturn MappedIOStream::Seek(size_t offset, aiOrigin origin) {
+    size_t position;
+    if (origin == aiOrigin_SET)
+        position = offset;
+    else if (origin == aiOrigin_CUR)
+        position = m_position + offset;
+    else if (origin == aiOrigin_END && offset <= m_size)
+        position = m_size - offset;
+    else
+        return aiReturn_FAILURE;
+    if (position > m_size) return aiReturn_FAILURE;
+    m_position = position;
+    return aiReturn_SUCCESS;
+}
+
+size_t MappedIOStream::Tell() const {
+    return m_position;
+}
+
+size_t MappedIOStream::FileSize() const {
+    return m_size;
+}
+
+void MappedIOStream::Flush() {}
+
+bool MappedIOSystem::Exists(const char * filePath) const {
+    return QFileInfo::exists(QString::fromUtf8(filePath));
+}
+
+char MappedIOSystem::getOsSeparator() const {
+    return '/'; // Qt takes forward slashes everywhere, qrc paths need them
+}
+
+Assimp::IOStream * MappedIOSystem::Open(const char * filePath, const char * mode) {
+    if (strchr(mode, 'w') || strchr(mode, 'a') || strchr(mode, '+')) return 0;
+    QString path = QString::fromUtf8(filePath);
+
+    if (path.startsWith(':')) {
+        // Compressed resources have to be inflated into a buffer
+        QResource resource(path);
+        if (!resource.isValid()) return 0;
+        if (!resource.isCompressed())
+            return new MappedIOStream(0, resource.data(), size_t(resource.size()));
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly)) return 0;
+        return new MappedIOStream(file.readAll());
+    }
+
+    QFile* file = new QFile(path);
+    if (!file->open(QIODevice::ReadOnly)) {
+        delete file;
+        return 0;
+    }
+    if (file->size() == 0) {
+        delete file;
+        return new MappedIOStream(QByteArray());
+    }
+    if (const uchar* data = file->map(0, file->size()))
+        return new MappedIOStream(file, data, size_t(file->size()));
+
+    // Not mappable, e.g. a pipe or a special file system
+    QByteArray bytes = file->readAll();
+    delete file;
+    return new MappedIOStream(bytes);
+}
+
+void MappedIOSystem::Close(Assimp::IOStream * stream) {
+    delete stream;
+}
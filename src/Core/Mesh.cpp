@@ -1,266 +1,644 @@
-#include <Mesh.h>
-#include <AbstractGizmo.h>
-#include <AbstractLight.h>
-
-Mesh::Mesh(QObject * parent): AbstractEntity(0) {
-    m_meshType = Triangle;
-    m_material = 0;
-    setObjectName("Untitled Mesh");
-    setParent(parent);
-}
-
-Mesh::Mesh(MeshType _meshType, QObject * parent): AbstractEntity(0) {
-    m_meshType = _meshType;
-    m_material = 0;
-    setObjectName("Untitled Mesh");
-    setParent(parent);
-}
-
-Mesh::Mesh(const Mesh & mesh): AbstractEntity(mesh) {
-    m_meshType = mesh.m_meshType;
-    m_vertices = mesh.m_vertices;
-    m_indices = mesh.m_indices;
-    m_material = new Material(*mesh.m_material);
-    setObjectName(mesh.objectName());
-}
-
-Mesh::~Mesh() {
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << "Mesh" << this->objectName() << "is destroyed";
-}
-
-// Dump info
-
-void Mesh::dumpObjectInfo(int l) {
-    qDebug().nospace() << tab(l) << "Mesh: " << objectName();
-    qDebug().nospace() << tab(l + 1) << "Type: " <<
-        (m_meshType == Triangle ? "Triangle" : (m_meshType == Line ? "Line" : "Point"));
-    qDebug().nospace() << tab(l + 1) << "Visible: " << m_visible;
-    qDebug().nospace() << tab(l + 1) << "Position: " << m_position;
-    qDebug().nospace() << tab(l + 1) << "Rotation: " << m_rotation;
-    qDebug().nospace() << tab(l + 1) << "Scaling:  " << m_scaling;
-    qDebug("%s%d vertices, %d indices, %d material",
-           tab(l + 1), m_vertices.size(), m_indices.size(), m_material != 0);
-}
-
-void Mesh::dumpObjectTree(int l) {
-    dumpObjectInfo(l);
-    if (m_material)
-        m_material->dumpObjectTree(l + 1);
-}
-
-bool Mesh::isGizmo() const {
-    if (qobject_cast<AbstractGizmo*>(parent())) return true;
-    return false;
-}
-
-bool Mesh::isLight() const {
-    if (qobject_cast<AbstractLight*>(parent())) return true;
-    return false;
-}
-
-bool Mesh::isMesh() const {
-    if (isGizmo()) return false;
-    if (isLight()) return false;
-    return true;
-}
-
-bool Mesh::isModel() const {
-    return false;
-}
-
-QVector3D Mesh::centerOfMass() const {
-    QVector3D centerOfMass;
-    float totalMass = 0;
-    QMatrix4x4 modelMat = globalModelMatrix();
-    for (int i = 0; i < m_indices.size();) {
-        QVector3D centroid;
-        float mass = 0;
-        if (m_meshType == Point) {
-            centroid = modelMat * m_vertices[m_indices[i + 0]].position;
-            mass = 1.0f;
-            i += 1;
-        } else if (m_meshType == Line) {
-            QVector3D p0 = modelMat * m_vertices[m_indices[i + 0]].position;
-            QVector3D p1 = modelMat * m_vertices[m_indices[i + 1]].position;
-            centroid = (p0 + p1) / 2;
-            mass = p0.distanceToPoint(p1);
-            i += 2;
-        } else if (m_meshType == Triangle) {
-            QVector3D p0 = modelMat * m_vertices[m_indices[i + 0]].position;
-            QVector3D p1 = modelMat * m_vertices[m_indices[i + 1]].position;
-            QVector3D p2 = modelMat * m_vertices[m_indices[i + 2]].position;
-            centroid = (p0 + p1 + p2) / 3;
-            mass = QVector3D::crossProduct(p1 - p0, p2 - p0).length() / 2;
-            i += 3;
-        }
-        centerOfMass += centroid * mass;
-        totalMass += mass;
-    }
-    return centerOfMass / totalMass;
-}
-
-float Mesh::mass() const {
-    float totalMass = 0;
-    QMatrix4x4 modelMat = globalModelMatrix();
-    for (int i = 0; i < m_indices.size();) {
-        if (m_meshType == Point) {
-            totalMass += 1.0f;
-            i += 1;
-        } else if (m_meshType == Line) {
-            QVector3D p0 = modelMat * m_vertices[m_indices[i + 0]].position;
-            QVector3D p1 = modelMat * m_vertices[m_indices[i + 1]].position;
-            totalMass += p0.distanceToPoint(p1);
-            i += 2;
-        } else if (m_meshType == Triangle) {
-            QVector3D p0 = modelMat * m_vertices[m_indices[i + 0]].position;
-            QVector3D p1 = modelMat * m_vertices[m_indices[i + 1]].position;
-            QVector3D p2 = modelMat * m_vertices[m_indices[i + 2]].position;
-            totalMass += QVector3D::crossProduct(p1 - p0, p2 - p0).length() / 2;
-            i += 3;
-        }
-    }
-    return totalMass;
-}
-
-Mesh::MeshType Mesh::meshType() const {
-    return m_meshType;
-}
-
-const QVector<Vertex>& Mesh::vertices() const {
-    return m_vertices;
-}
-
-const QVector<uint32_t>& Mesh::indices() const {
-    return m_indices;
-}
-
-Material * Mesh::material() const{
-    return m_material;
-}
-
-Mesh * Mesh::merge(const Mesh * mesh1, const Mesh * mesh2) {
-    if (mesh1 == 0 && mesh2 == 0)
-        return 0;
-    else if (mesh1 == 0 || mesh2 == 0) {
-        if (mesh1 == 0) mesh1 = mesh2;
-        Mesh* mergedMesh = new Mesh(mesh1->meshType());
-        mergedMesh->setObjectName(mesh1->objectName());
-        mergedMesh->setMaterial(new Material(*mesh1->material()));
-        for (int i = 0; i < mesh1->m_vertices.size(); i++)
-            mergedMesh->m_vertices.push_back(mesh1->globalModelMatrix() * mesh1->m_vertices[i]);
-        mergedMesh->m_indices = mesh1->m_indices;
-        return mergedMesh;
-    }
-
-    if (mesh1->meshType() != mesh2->meshType()) {
-        if (log_level >= LOG_LEVEL_ERROR)
-            dout << "Failed to merge" << mesh1->objectName() << "and" << mesh2->objectName() << ": type not match";
-        return 0;
-    }
-
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << "Merging" << mesh1->objectName() << "and" << mesh2->objectName();
-
-    Mesh* mergedMesh = new Mesh(mesh1->meshType());
-    mergedMesh->setObjectName(mesh1->objectName() + mesh2->objectName());
-    mergedMesh->setMaterial(new Material);
-
-    for (int i = 0; i < mesh1->m_vertices.size(); i++)
-        mergedMesh->m_vertices.push_back(mesh1->globalModelMatrix() * mesh1->m_vertices[i]);
-
-    for (int i = 0; i < mesh2->m_vertices.size(); i++)
-        mergedMesh->m_vertices.push_back(mesh2->globalModelMatrix() * mesh2->m_vertices[i]);
-
-    mergedMesh->m_indices = mesh1->m_indices;
-    for (int i = 0; i < mesh2->m_indices.size(); i++)
-        mergedMesh->m_indices.push_back(mesh2->m_indices[i] + mesh1->m_vertices.size());
-
-    return mergedMesh;
-}
-
-void Mesh::setMeshType(MeshType meshType) {
-    if (m_meshType != meshType) {
-        m_meshType = meshType;
-        if (log_level >= LOG_LEVEL_INFO)
-            dout << "The type of mesh" << this->objectName() << "is set to"
-                 << (m_meshType == Triangle ? "Triangle" : (m_meshType == Line ? "Line" : "Point"));
-        meshTypeChanged(m_meshType);
-    }
-}
-
-void Mesh::setGeometry(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices) {
-    if (m_vertices != vertices || m_indices != indices) {
-        m_vertices = vertices;
-        m_indices = indices;
-        geometryChanged(m_vertices, m_indices);
-    }
-}
-
-bool Mesh::setMaterial(Material * material) {
-    if (m_material == material) return false;
-
-    if (m_material) {
-        Material* tmp = m_material;
-        m_material = 0;
-        delete tmp;
-    }
-
-    if (material) {
-        m_material = material;
-        m_material->setParent(this);
-        if (log_level >= LOG_LEVEL_INFO)
-            dout << "Material" << material->objectName() << "is assigned to mesh" << objectName();
-    }
-
-    materialChanged(m_material);
-    return true;
-}
-
-void Mesh::reverseNormals() {
-    for (int i = 0; i < m_vertices.size(); i++)
-        m_vertices[i].normal = -m_vertices[i].normal;
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << "Normals of" << this->objectName() << "is reversed";
-    geometryChanged(m_vertices, m_indices);
-}
-
-void Mesh::reverseTangents() {
-    for (int i = 0; i < m_vertices.size(); i++)
-        m_vertices[i].tangent = -m_vertices[i].tangent;
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << "Tangents of" << this->objectName() << "is reversed";
-    geometryChanged(m_vertices, m_indices);
-}
-
-void Mesh::reverseBitangents() {
-    for (int i = 0; i < m_vertices.size(); i++)
-        m_vertices[i].bitangent = -m_vertices[i].bitangent;
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << "Bitangents of" << this->objectName() << "is reversed";
-    geometryChanged(m_vertices, m_indices);
-}
-
-void Mesh::childEvent(QChildEvent * e) {
-    if (e->added()) {
-        if (Material* material = qobject_cast<Material*>(e->child()))
-            setMaterial(material);
-    } else if (e->removed()) {
-        if (e->child() == m_material) {
-            m_material = 0;
-            materialChanged(0);
-        }
-    }
-}
-
-QDataStream & operator>>(QDataStream & in, Mesh::MeshType & meshType) {
-    qint32 t;
-    in >> t;
-    if (t == 0)
-        meshType = Mesh::Triangle;
-    else if (t == 1)
-        meshType = Mesh::Line;
-    else
-        meshType = Mesh::Point;
-    return in;
-}
+#include <Mesh.h>
+#include <AbstractGizmo.h>
+#include <AbstractLight.h>
+
+// Below this many vertices a merge is not worth spreading across threads
+static const int parallelMergeThreshold = 65536;
+
+// Ids handed out to new geometries, 0 is never used
+static QAtomicInteger<quint64> geometryCounter(0);
+
+static quint64 newGeometryId() {
+    return ++geometryCounter;
+}
+
+Mesh::Mesh(QObject * parent): AbstractEntity(0) {
+    m_meshType = Triangle;
+    m_vertexLayout = VertexLayout::Standard;
+    m_storageMode = Interleaved;
+    m_material = 0;
+    m_geometryId = newGeometryId();
+    m_bvhGeometryId = 0;
+    m_massDirty = true;
+    setObjectName("Untitled Mesh");
+    setParent(parent);
+}
+
+Mesh::Mesh(MeshType _meshType, QObject * parent): AbstractEntity(0) {
+    m_meshType = _meshType;
+    m_vertexLayout = VertexLayout::Standard;
+    m_storageMode = Interleaved;
+    m_material = 0;
+    m_geometryId = newGeometryId();
+    m_bvhGeometryId = 0;
+    m_massDirty = true;
+    setObjectName("Untitled Mesh");
+    setParent(parent);
+}
+
+Mesh::Mesh(const Mesh & mesh): AbstractEntity(mesh) {
+    m_meshType = mesh.m_meshType;
+    m_vertexLayout = mesh.m_vertexLayout;
+    m_storageMode = mesh.m_storageMode;
+    m_vertices = mesh.m_vertices;
+    m_streams = mesh.m_streams;
+    m_indices = mesh.m_indices;
+    m_lodIndices = mesh.m_lodIndices;
+    m_meshlets = mesh.m_meshlets;
+    m_geometryId = mesh.m_geometryId; // shared until either copy is written to
+    m_bvh = mesh.m_bvh;
+    m_bvhGeometryId = mesh.m_bvhGeometryId;
+    m_localBoundingBox = mesh.m_localBoundingBox;
+    m_localBoundingSphere = mesh.m_localBoundingSphere;
+    m_massDirty = mesh.m_massDirty;
+    m_localMass = mesh.m_localMass;
+    m_localCenterOfMass = mesh.m_localCenterOfMass;
+    m_material = new Material(*mesh.m_material);
+    setObjectName(mesh.objectName());
+}
+
+Mesh::~Mesh() {
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Mesh" << this->objectName() << "is destroyed";
+}
+
+// Dump info
+
+void Mesh::dumpObjectInfo(int l) {
+    qDebug().nospace() << tab(l) << "Mesh: " << objectName();
+    qDebug().nospace() << tab(l + 1) << "Type: " <<
+        (m_meshType == Triangle ? "Triangle" : (m_meshType == Line ? "Line" : "Point"));
+    qDebug().nospace() << tab(l + 1) << "Visible: " << m_visible;
+    qDebug().nospace() << tab(l + 1) << "Position: " << m_position;
+    qDebug().nospace() << tab(l + 1) << "Rotation: " << m_rotation;
+    qDebug().nospace() << tab(l + 1) << "Scaling:  " << m_scaling;
+    qDebug("%s%d vertices, %d indices, %d LODs, %d meshlets, %d material",
+           tab(l + 1), vertexCount(), m_indices.size(), m_lodIndices.size(), m_meshlets.size(), m_material != 0);
+}
+
+void Mesh::dumpObjectTree(int l) {
+    dumpObjectInfo(l);
+    if (m_material)
+        m_material->dumpObjectTree(l + 1);
+}
+
+bool Mesh::isGizmo() const {
+    if (qobject_cast<AbstractGizmo*>(parent())) return true;
+    return false;
+}
+
+bool Mesh::isLight() const {
+    if (qobject_cast<AbstractLight*>(parent())) return true;
+    return false;
+}
+
+bool Mesh::isMesh() const {
+    if (isGizmo()) return false;
+    if (isLight()) return false;
+    return true;
+}
+
+bool Mesh::isModel() const {
+    return false;
+}
+
+int Mesh::dimension() const {
+    return m_meshType == Triangle ? 2 : (m_meshType == Line ? 1 : 0);
+}
+
+QVector3D Mesh::localCenterOfMass() const {
+    if (m_massDirty) updateMass();
+    return m_localCenterOfMass;
+}
+
+float Mesh::localMass() const {
+    if (m_massDirty) updateMass();
+    return m_localMass;
+}
+
+QVector3D Mesh::centerOfMass() const {
+    float mass;
+    QVector3D moment;
+    massProperties(globalModelMatrix(), mass, moment);
+    if (mass > 0)
+        return moment / mass;
+    return globalModelMatrix() * localCenterOfMass();
+}
+
+float Mesh::mass() const {
+    float mass;
+    QVector3D moment;
+    massProperties(globalModelMatrix(), mass, moment);
+    return mass;
+}
+
+void Mesh::massProperties(const QMatrix4x4 & modelMat, float & mass, QVector3D & moment) const {
+    // Point counts don't depend on the transform, lengths and areas only scale
+    // uniformly under similarities
+    if (dimension() == 0 || isSimilarity(modelMat)) {
+        mass = localMass() * measureScale(modelMat, dimension());
+        moment = (modelMat * localCenterOfMass()) * mass;
+    } else
+        integrateMass(modelMat, mass, moment);
+}
+
+const AABB & Mesh::localBoundingBox() const {
+    return m_localBoundingBox;
+}
+
+const Sphere & Mesh::localBoundingSphere() const {
+    return m_localBoundingSphere;
+}
+
+AABB Mesh::boundingBox() const {
+    return globalModelMatrix() * m_localBoundingBox;
+}
+
+Sphere Mesh::boundingSphere() const {
+    return globalModelMatrix() * m_localBoundingSphere;
+}
+
+Mesh::MeshType Mesh::meshType() const {
+    return m_meshType;
+}
+
+int Mesh::vertexLayout() const {
+    return m_vertexLayout;
+}
+
+Mesh::StorageMode Mesh::storageMode() const {
+    return m_storageMode;
+}
+
+int Mesh::vertexCount() const {
+    return m_storageMode == Separate ? m_streams.size() : m_vertices.size();
+}
+
+VertexAttributes Mesh::attributes() const {
+    if (m_storageMode == Separate)
+        return m_streams.attributes();
+    return VertexAttributes(m_vertices.constData(), m_vertices.size());
+}
+
+const QVector<Vertex>& Mesh::vertices() const {
+    if (m_storageMode == Separate && m_vertices.size() != m_streams.size())
+        m_vertices = m_streams.interleave();
+    return m_vertices;
+}
+
+const QVector<uint32_t>& Mesh::indices() const {
+    return m_indices;
+}
+
+Material * Mesh::material() const{
+    return m_material;
+}
+
+int Mesh::lodCount() const {
+    return m_lodIndices.size() + 1;
+}
+
+const QVector<uint32_t>& Mesh::lodIndices(int level) const {
+    if (level <= 0 || level > m_lodIndices.size())
+        return m_indices;
+    return m_lodIndices[level - 1];
+}
+
+void Mesh::setLodIndices(const QVector<QVector<uint32_t>>& lods) {
+    for (int i = 0; i < lods.size(); i++)
+        for (int j = 0; j < lods[i].size(); j++)
+            if (lods[i][j] >= uint32_t(vertexCount())) {
+                if (log_level >= LOG_LEVEL_ERROR)
+                    dout << "Failed to set LODs of" << this->objectName() << ": index out of range";
+                return;
+            }
+    m_lodIndices = lods;
+    m_geometryId = newGeometryId();
+    lodsChanged();
+}
+
+quint64 Mesh::geometryId() const {
+    return m_geometryId;
+}
+
+QSharedPointer<const MeshBVH> Mesh::bvh() const {
+    if (m_meshType != Triangle) return QSharedPointer<const MeshBVH>();
+    if (m_bvh.isNull() || m_bvhGeometryId != m_geometryId) {
+        m_bvh = QSharedPointer<const MeshBVH>(new MeshBVH(attributes(), m_indices));
+        m_bvhGeometryId = m_geometryId;
+    }
+    return m_bvh;
+}
+
+bool Mesh::raycast(const Line & ray, RayHit & hit, float maxDistance) const {
+    return raycast(ray, globalModelMatrix(), hit, maxDistance);
+}
+
+bool Mesh::raycast(const Line & ray, const QMatrix4x4 & modelMat, RayHit & hit, float maxDistance) const {
+    QSharedPointer<const MeshBVH> tree = bvh();
+    if (tree.isNull()) return false;
+
+    // The local direction isn't normalized, so distances stay in world units
+    bool invertible;
+    QMatrix4x4 invModelMat = modelMat.inverted(&invertible);
+    if (!invertible) return false;
+    Ray localRay(invModelMat.map(ray.st), invModelMat.mapVector(ray.dir));
+    RayHit localHit;
+    if (!tree->raycast(localRay, maxDistance, localHit)) return false;
+
+    hit = localHit;
+    hit.point = ray.st + ray.dir * localHit.distance;
+    return true;
+}
+
+const QVector<Meshlet>& Mesh::meshlets() const {
+    return m_meshlets;
+}
+
+void Mesh::setMeshlets(const QVector<uint32_t>& indices, const QVector<Meshlet>& meshlets) {
+    int end = 0;
+    for (int i = 0; i < meshlets.size(); i++) {
+        if (meshlets[i].indexOffset != end) break;
+        end += meshlets[i].indexCount;
+    }
+    if (indices.size() != m_indices.size() || (meshlets.size() && end != indices.size())) {
+        if (log_level >= LOG_LEVEL_ERROR)
+            dout << "Failed to set meshlets of" << this->objectName() << ": ranges don't cover the indices";
+        return;
+    }
+    m_indices = indices;
+    m_meshlets = meshlets;
+    m_geometryId = newGeometryId();
+    meshletsChanged();
+}
+
+void Mesh::setStorageMode(StorageMode storageMode) {
+    if (m_storageMode == storageMode) return;
+    if (storageMode == Separate) {
+        m_streams = VertexStreams(m_vertices.constData(), m_vertices.size());
+        m_vertices = QVector<Vertex>();
+    } else {
+        m_vertices = m_streams.interleave();
+        m_streams.clear();
+    }
+    m_storageMode = storageMode;
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "The storage mode of mesh" << this->objectName() << "is set to"
+             << (m_storageMode == Separate ? "Separate" : "Interleaved");
+}
+
+bool Mesh::sameVertices(const QVector<Vertex>& vertices) const {
+    if (m_storageMode == Interleaved)
+        return m_vertices == vertices;
+    if (m_streams.size() != vertices.size())
+        return false;
+    VertexAttributes current = m_streams.attributes();
+    for (int i = 0; i < vertices.size(); i++)
+        if (!(current.vertex(i) == vertices[i]))
+            return false;
+    return true;
+}
+
+Mesh * Mesh::merge(const Mesh * mesh1, const Mesh * mesh2) {
+    QVector<const Mesh*> meshes;
+    if (mesh1) meshes.push_back(mesh1);
+    if (mesh2) meshes.push_back(mesh2);
+    return merge(meshes);
+}
+
+// Merging is split into one job per mesh, each writing its own range of the output
+struct MergeJob {
+    const Mesh* mesh;
+    QMatrix4x4 modelMat;
+    Vertex* vertices;
+    uint32_t* indices;
+    uint32_t baseVertex;
+};
+
+static void runMergeJob(MergeJob& job) {
+    const QVector<uint32_t>& indices = job.mesh->indices();
+    int vertexCount = job.mesh->vertexCount();
+    if (job.mesh->storageMode() == Mesh::Interleaved)
+        transformVertices(job.modelMat, job.mesh->vertices().constData(), job.vertices, vertexCount);
+    else {
+        job.mesh->attributes().gather(0, vertexCount, job.vertices);
+        transformVertices(job.modelMat, job.vertices, job.vertices, vertexCount);
+    }
+    for (int i = 0; i < indices.size(); i++)
+        job.indices[i] = indices[i] + job.baseVertex;
+}
+
+Mesh * Mesh::merge(const QVector<const Mesh*>& meshes) {
+    if (meshes.size() == 0)
+        return 0;
+
+    for (int i = 1; i < meshes.size(); i++)
+        if (meshes[i]->meshType() != meshes[0]->meshType()) {
+            if (log_level >= LOG_LEVEL_ERROR)
+                dout << "Failed to merge" << meshes[0]->objectName() << "and" << meshes[i]->objectName() << ": type not match";
+            return 0;
+        }
+
+    if (log_level >= LOG_LEVEL_INFO && meshes.size() > 1)
+        dout << "Merging" << meshes.size() << "meshes";
+
+    // Size the output once, each mesh gets its own slice of it
+    QVector<MergeJob> jobs(meshes.size());
+    int vertexCount = 0, indexCount = 0;
+    for (int i = 0; i < meshes.size(); i++) {
+        jobs[i].mesh = meshes[i];
+        jobs[i].modelMat = meshes[i]->globalModelMatrix(); // not thread-safe, resolve it here
+        jobs[i].baseVertex = uint32_t(vertexCount);
+        vertexCount += meshes[i]->vertexCount();
+        indexCount += meshes[i]->m_indices.size();
+    }
+
+    Mesh* mergedMesh = new Mesh(meshes[0]->meshType());
+    if (meshes.size() == 1) {
+        mergedMesh->setObjectName(meshes[0]->objectName());
+        mergedMesh->setMaterial(meshes[0]->material() ? new Material(*meshes[0]->material()) : new Material);
+    } else {
+        QString name;
+        for (int i = 0; i < meshes.size(); i++)
+            name += meshes[i]->objectName();
+        mergedMesh->setObjectName(name);
+        mergedMesh->setMaterial(new Material);
+    }
+
+    mergedMesh->m_vertices.resize(vertexCount);
+    mergedMesh->m_indices.resize(indexCount);
+    Vertex* vertices = mergedMesh->m_vertices.data();
+    uint32_t* indices = mergedMesh->m_indices.data();
+    for (int i = 0; i < jobs.size(); i++) {
+        jobs[i].vertices = vertices;
+        jobs[i].indices = indices;
+        vertices += meshes[i]->vertexCount();
+        indices += meshes[i]->m_indices.size();
+    }
+
+    if (jobs.size() > 1 && vertexCount >= parallelMergeThreshold)
+        QtConcurrent::blockingMap(jobs, runMergeJob);
+    else
+        for (int i = 0; i < jobs.size(); i++)
+            runMergeJob(jobs[i]);
+
+    mergedMesh->updateBounds();
+    return mergedMesh;
+}
+
+void Mesh::setMeshType(MeshType meshType) {
+    if (m_meshType != meshType) {
+        m_meshType = meshType;
+        m_massDirty = true;
+        if (log_level >= LOG_LEVEL_INFO)
+            dout << "The type of mesh" << this->objectName() << "is set to"
+                 << (m_meshType == Triangle ? "Triangle" : (m_meshType == Line ? "Line" : "Point"));
+        meshTypeChanged(m_meshType);
+    }
+}
+
+void Mesh::setVertexLayout(int options) {
+    if (m_vertexLayout != options) {
+        m_vertexLayout = options;
+        if (log_level >= LOG_LEVEL_INFO)
+            dout << "The vertex layout of mesh" << this->objectName() << "is set to" << options;
+        vertexLayoutChanged(m_vertexLayout);
+    }
+}
+
+void Mesh::setGeometry(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices) {
+    if (!sameVertices(vertices) || m_indices != indices) {
+        if (m_storageMode == Separate) {
+            m_streams = VertexStreams(vertices.constData(), vertices.size());
+            m_vertices.clear();
+        } else
+            m_vertices = vertices;
+        m_indices = indices;
+        m_lodIndices.clear();
+        m_meshlets.clear();
+        m_geometryId = newGeometryId();
+        m_massDirty = true;
+        updateBounds();
+        geometryChanged(m_vertices, m_indices);
+    }
+}
+
+void Mesh::setGeometry(QVector<Vertex>&& vertices, QVector<uint32_t>&& indices) {
+    if (m_storageMode == Separate) {
+        m_streams = VertexStreams(vertices.constData(), vertices.size());
+        m_vertices.clear();
+        vertices.clear();
+    } else
+        m_vertices = std::move(vertices);
+    m_indices = std::move(indices);
+    m_lodIndices.clear();
+    m_meshlets.clear();
+    m_geometryId = newGeometryId();
+    m_massDirty = true;
+    updateBounds();
+    geometryChanged(m_vertices, m_indices);
+}
+
+void Mesh::updateVertices(int offset, const Vertex * vertices, int count) {
+    if (offset < 0 || count <= 0 || offset + count > vertexCount()) {
+        if (log_level >= LOG_LEVEL_ERROR)
+            dout << "Failed to update vertices of" << this->objectName() << ": range out of bounds";
+        return;
+    }
+
+    // The bounds can only shrink if a replaced vertex was lying on them
+    AttributeView<QVector3D> positions = attributes().positions;
+    bool mayShrink = false;
+    for (int i = offset; i < offset + count && !mayShrink; i++)
+        for (int j = 0; j < 3; j++)
+            if (positions[i][j] <= m_localBoundingBox.minimum[j] ||
+                positions[i][j] >= m_localBoundingBox.maximum[j])
+                mayShrink = true;
+
+    if (m_storageMode == Separate) {
+        m_streams.scatter(offset, vertices, count);
+        m_vertices.clear();
+    } else
+        for (int i = 0; i < count; i++)
+            m_vertices[offset + i] = vertices[i];
+    m_geometryId = newGeometryId();
+    m_massDirty = true;
+
+    if (mayShrink)
+        updateBounds();
+    else
+        for (int i = 0; i < count; i++) {
+            m_localBoundingBox.merge(vertices[i].position);
+            m_localBoundingSphere.merge(Sphere(vertices[i].position, 0.0f));
+        }
+
+    verticesUpdated(offset, count);
+
+    // The cluster bounds and cones no longer hold
+    if (m_meshlets.size()) {
+        m_meshlets.clear();
+        meshletsChanged();
+    }
+}
+
+bool Mesh::setMaterial(Material * material) {
+    if (m_material == material) return false;
+
+    if (m_material) {
+        Material* tmp = m_material;
+        m_material = 0;
+        delete tmp;
+    }
+
+    if (material) {
+        m_material = material;
+        m_material->setParent(this);
+        if (log_level >= LOG_LEVEL_INFO)
+            dout << "Material" << material->objectName() << "is assigned to mesh" << objectName();
+    }
+
+    materialChanged(m_material);
+    return true;
+}
+
+// Packed streams negate as a flat float array
+static void reverseStream(AlignedArray<QVector3D>& stream) {
+    float* data = reinterpret_cast<float*>(stream.data());
+    for (int i = 0; i < stream.size() * 3; i++)
+        data[i] = -data[i];
+}
+
+void Mesh::reverseNormals() {
+    if (m_storageMode == Separate) {
+        reverseStream(m_streams.normals);
+        m_vertices.clear();
+    } else
+        for (int i = 0; i < m_vertices.size(); i++)
+            m_vertices[i].normal = -m_vertices[i].normal;
+    m_geometryId = newGeometryId();
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Normals of" << this->objectName() << "is reversed";
+    geometryChanged(m_vertices, m_indices);
+}
+
+void Mesh::reverseTangents() {
+    if (m_storageMode == Separate) {
+        reverseStream(m_streams.tangents);
+        m_vertices.clear();
+    } else
+        for (int i = 0; i < m_vertices.size(); i++)
+            m_vertices[i].tangent = -m_vertices[i].tangent;
+    m_geometryId = newGeometryId();
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Tangents of" << this->objectName() << "is reversed";
+    geometryChanged(m_vertices, m_indices);
+}
+
+void Mesh::reverseBitangents() {
+    if (m_storageMode == Separate) {
+        reverseStream(m_streams.bitangents);
+        m_vertices.clear();
+    } else
+        for (int i = 0; i < m_vertices.size(); i++)
+            m_vertices[i].bitangent = -m_vertices[i].bitangent;
+    m_geometryId = newGeometryId();
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Bitangents of" << this->objectName() << "is reversed";
+    geometryChanged(m_vertices, m_indices);
+}
+
+void Mesh::childEvent(QChildEvent * e) {
+    AbstractEntity::childEvent(e);
+    if (e->added()) {
+        if (Material* material = qobject_cast<Material*>(e->child()))
+            setMaterial(material);
+    } else if (e->removed()) {
+        if (e->child() == m_material) {
+            m_material = 0;
+            materialChanged(0);
+        }
+    }
+}
+
+void Mesh::updateBounds() {
+    AttributeView<QVector3D> positions = attributes().positions;
+    m_localBoundingBox = AABB();
+    if (positions.isPacked()) {
+        // A flat float array, the compiler vectorizes the min/max over it
+        const float* p = reinterpret_cast<const float*>(positions.data());
+        float minimum[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, maximum[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        for (int i = 0; i < positions.size(); i++, p += 3)
+            for (int j = 0; j < 3; j++) {
+                minimum[j] = qMin(minimum[j], p[j]);
+                maximum[j] = qMax(maximum[j], p[j]);
+            }
+        m_localBoundingBox = AABB(QVector3D(minimum[0], minimum[1], minimum[2]), QVector3D(maximum[0], maximum[1], maximum[2]));
+    } else
+        for (int i = 0; i < positions.size(); i++)
+            m_localBoundingBox.merge(positions[i]);
+
+    if (m_localBoundingBox.isEmpty()) {
+        m_localBoundingSphere = Sphere();
+        return;
+    }
+
+    // Centered on the box, which is within a few percent of the optimal sphere for typical meshes
+    QVector3D center = m_localBoundingBox.center();
+    float radius2 = 0;
+    for (int i = 0; i < positions.size(); i++)
+        radius2 = qMax(radius2, (positions[i] - center).lengthSquared());
+    m_localBoundingSphere = Sphere(center, qSqrt(radius2));
+}
+
+void Mesh::updateMass() const {
+    QVector3D moment;
+    integrateMass(QMatrix4x4(), m_localMass, moment);
+    // Degenerated geometry has no mass, fall back to the center of the bounds
+    if (m_localMass > 0)
+        m_localCenterOfMass = moment / m_localMass;
+    else
+        m_localCenterOfMass = m_localBoundingBox.isEmpty() ? QVector3D(0, 0, 0) : m_localBoundingBox.center();
+    m_massDirty = false;
+}
+
+void Mesh::integrateMass(const QMatrix4x4 & modelMat, float & mass, QVector3D & moment) const {
+    AttributeView<QVector3D> positions = attributes().positions;
+    mass = 0;
+    moment = QVector3D(0, 0, 0);
+    for (int i = 0; i < m_indices.size();) {
+        QVector3D centroid;
+        float m = 0;
+        if (m_meshType == Point) {
+            centroid = modelMat * positions[m_indices[i + 0]];
+            m = 1.0f;
+            i += 1;
+        } else if (m_meshType == Line) {
+            QVector3D p0 = modelMat * positions[m_indices[i + 0]];
+            QVector3D p1 = modelMat * positions[m_indices[i + 1]];
+            centroid = (p0 + p1) / 2;
+            m = p0.distanceToPoint(p1);
+            i += 2;
+        } else if (m_meshType == Triangle) {
+            QVector3D p0 = modelMat * positions[m_indices[i + 0]];
+            QVector3D p1 = modelMat * positions[m_indices[i + 1]];
+            QVector3D p2 = modelMat * positions[m_indices[i + 2]];
+            centroid = (p0 + p1 + p2) / 3;
+            m = QVector3D::crossProduct(p1 - p0, p2 - p0).length() / 2;
+            i += 3;
+        }
+        moment += centroid * m;
+        mass += m;
+    }
+}
+
+QDataStream & operator>>(QDataStream & in, Mesh::MeshType & meshType) {
+    qint32 t;
+    in >> t;
+    if (t == 0)
+        meshType = Mesh::Triangle;
+    else if (t == 1)
+        meshType = Mesh::Line;
+    else
+        meshType = Mesh::Point;
+    return in;
+}
@@ -0,0 +1,71 @@
+#include <MeshBVH.h>
+
+// Möller-Trumbore test of leaf triangles, keeps the nearest hit
+class TriangleVisitor: public BVH::RayVisitor {
+public:
+    const Ray* ray;
+    const QVector3D* corners;
+    const int* slots; // primitive -> position of its corners in `corners`
+    RayHit* hit;
+    bool found;
+
+    void visit(int primitive, float& maxDistance) override {
+        const QVector3D* p = corners + slots[primitive] * 3;
+        QVector3D e1 = p[1] - p[0], e2 = p[2] - p[0];
+        QVector3D q = QVector3D::crossProduct(ray->direction, e2);
+        float det = QVector3D::dotProduct(e1, q);
+        if (qAbs(det) < FLT_MIN) return;
+        float invDet = 1.0f / det;
+        QVector3D s = ray->origin - p[0];
+        float u = QVector3D::dotProduct(s, q) * invDet;
+        if (u < 0.0f || u > 1.0f) return;
+        QVector3D r = QVector3D::crossProduct(s, e1);
+        float v = QVector3D::dotProduct(ray->direction, r) * invDet;
+        if (v < 0.0f || u + v > 1.0f) return;
+        float t = QVector3D::dotProduct(e2, r) * invDet;
+        if (t < 0.0f || t >= maxDistance) return;
+
+        maxDistance = t;
+        hit->distance = t;
+        hit->triangle = primitive;
+        hit->barycentric = QVector2D(u, v);
+        found = true;
+    }
+};
+
+MeshBVH::MeshBVH(const VertexAttributes & attributes, const QVector<uint32_t>& indices) {
+    int triangleCount = indices.size() / 3;
+    QVector<AABB> boxes(triangleCount);
+    for (int i = 0; i < triangleCount; i++)
+        for (int k = 0; k < 3; k++)
+            boxes[i].merge(attributes.positions[indices[i * 3 + k]]);
+    m_tree.build(boxes);
+
+    const QVector<int>& primitives = m_tree.primitives();
+    m_corners.resize(triangleCount * 3);
+    m_slots.resize(triangleCount);
+    for (int i = 0; i < primitives.size(); i++) {
+        for (int k = 0; k < 3; k++)
+            m_corners[i * 3 + k] = attributes.positions[indices[primitives[i] * 3 + k]];
+        m_slots[primitives[i]] = i;
+    }
+}
+
+int MeshBVH::triangleCount() const {
+    return m_corners.size() / 3;
+}
+
+const BVH & MeshBVH::tree() const {
+    return m_tree;
+}
+
+bool MeshBVH::raycast(const Ray & ray, float maxDistance, RayHit & hit) const {
+    TriangleVisitor visitor;
+    visitor.ray = &ray;
+    visitor.corners = m_corners.constData();
+    visitor.slots = m_slots.constData();
+    visitor.hit = &hit;
+    visitor.found = false;
+    m_tree.raycast(ray, maxDistance, visitor);
+    return visitor.found;
+}
@@ -0,0 +1,404 @@
+#include <MeshOptimizer.h>
+
+static const int forsythCacheSize = 32;
+static const int simulatedCacheSize = 16;
+
+// Forsyth's vertex score: recently used vertices and vertices with few
+// remaining triangles are preferred
+static float forsythScore(int cachePosition, int remainingValence) {
+    if (remainingValence == 0) return -1.0f;
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) // used by the last triangle
+            score = 0.75f;
+        else
+            score = qPow(1.0f - float(cachePosition - 3) / (forsythCacheSize - 3), 1.5f);
+    }
+    return score + 2.0f / qSqrt(float(remainingValence));
+}
+
+MeshOptimizer::Statistics MeshOptimizer::optimize(Mesh * mesh, int options) {
+    Statistics statistics = { 0, 0, 0 };
+    if (!mesh) return statistics;
+    if (mesh->meshType() != Mesh::Triangle) {
+        if (log_level >= LOG_LEVEL_WARNING)
+            dout << "Mesh" << mesh->objectName() << "is not a triangle mesh, skip optimization";
+        return statistics;
+    }
+    QVector<Vertex> vertices = mesh->vertices();
+    QVector<uint32_t> indices = mesh->indices();
+    statistics = optimize(vertices, indices, options);
+    mesh->setGeometry(std::move(vertices), std::move(indices));
+    return statistics;
+}
+
+MeshOptimizer::Statistics MeshOptimizer::optimize(QVector<Vertex>& vertices, QVector<uint32_t>& indices, int options) {
+    Statistics statistics = { indices.size() / 3, 0, 0 };
+    if (options == None || indices.size() < 3) return statistics;
+
+    statistics.acmrBefore = computeACMR(indices, vertices.size());
+
+    if (options & VertexCache)
+        optimizeVertexCache(indices, vertices.size());
+    if (options & Overdraw)
+        optimizeOverdraw(vertices, indices);
+    if (options & VertexFetch)
+        optimizeVertexFetch(vertices, indices);
+
+    statistics.acmrAfter = computeACMR(indices, vertices.size());
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Optimized" << statistics.triangles << "triangles, ACMR" << statistics.acmrBefore
+             << "->" << statistics.acmrAfter;
+    return statistics;
+}
+
+void MeshOptimizer::optimizeVertexCache(QVector<uint32_t>& indices, int vertexCount) {
+    int triangleCount = indices.size() / 3;
+    if (triangleCount < 2) return;
+
+    // Triangles using each vertex, the live ones are kept at the front of each list
+    QVector<int> valence(vertexCount, 0);
+    for (int i = 0; i < triangleCount * 3; i++)
+        valence[indices[i]]++;
+    QVector<int> adjacencyOffset(vertexCount + 1, 0);
+    for (int v = 0; v < vertexCount; v++)
+        adjacencyOffset[v + 1] = adjacencyOffset[v] + valence[v];
+    QVector<int> adjacency(triangleCount * 3);
+    QVector<int> fill = adjacencyOffset;
+    for (int t = 0; t < triangleCount; t++)
+        for (int k = 0; k < 3; k++)
+            adjacency[fill[indices[t * 3 + k]]++] = t;
+
+    QVector<int> cachePosition(vertexCount, -1);
+    QVector<float> vertexScore(vertexCount);
+    for (int v = 0; v < vertexCount; v++)
+        vertexScore[v] = forsythScore(-1, valence[v]);
+
+    QVector<float> triangleScore(triangleCount);
+    QVector<bool> emitted(triangleCount, false);
+    int bestTriangle = 0;
+    for (int t = 0; t < triangleCount; t++) {
+        triangleScore[t] = vertexScore[indices[t * 3 + 0]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+        if (triangleScore[t] > triangleScore[bestTriangle])
+            bestTriangle = t;
+    }
+
+    QVector<uint32_t> result;
+    result.reserve(triangleCount * 3);
+    uint32_t cache[forsythCacheSize + 3];
+    int cacheCount = 0, scanPos = 0;
+
+    while (result.size() < triangleCount * 3) {
+        if (bestTriangle < 0) {
+            // Nothing in the cache has triangles left, restart from the next remaining one
+            while (emitted[scanPos]) scanPos++;
+            bestTriangle = scanPos;
+        }
+
+        int t = bestTriangle;
+        emitted[t] = true;
+
+        uint32_t newCache[forsythCacheSize + 3];
+        int newCount = 0;
+        for (int k = 0; k < 3; k++) {
+            uint32_t v = indices[t * 3 + k];
+            result.push_back(v);
+
+            // Remove the triangle from the live list of the vertex
+            int begin = adjacencyOffset[v], end = begin + valence[v];
+            for (int i = begin; i < end; i++)
+                if (adjacency[i] == t) {
+                    qSwap(adjacency[i], adjacency[end - 1]);
+                    break;
+                }
+            valence[v]--;
+
+            bool duplicated = false;
+            for (int i = 0; i < newCount; i++)
+                duplicated = duplicated || newCache[i] == v;
+            if (!duplicated)
+                newCache[newCount++] = v;
+        }
+        for (int i = 0; i < cacheCount; i++) {
+            uint32_t v = cache[i];
+            if (v != indices[t * 3 + 0] && v != indices[t * 3 + 1] && v != indices[t * 3 + 2])
+                newCache[newCount++] = v;
+        }
+
+        // Rescore the vertices that moved in or fell out of the cache
+        for (int i = 0; i < newCount; i++) {
+            uint32_t v = newCache[i];
+            cachePosition[v] = i < forsythCacheSize ? i : -1;
+            float score = forsythScore(cachePosition[v], valence[v]);
+            float diff = score - vertexScore[v];
+            vertexScore[v] = score;
+            for (int j = adjacencyOffset[v]; j < adjacencyOffset[v] + valence[v]; j++)
+                triangleScore[adjacency[j]] += diff;
+        }
+
+        cacheCount = qMin(newCount, forsythCacheSize);
+        memcpy(cache, newCache, sizeof(uint32_t) * cacheCount);
+
+        // The next triangle is picked among the ones touching the cache
+        bestTriangle = -1;
+        float bestScore = -1.0f;
+        for (int i = 0; i < cacheCount; i++) {
+            uint32_t v = cache[i];
+            for (int j = adjacencyOffset[v]; j < adjacencyOffset[v] + valence[v]; j++)
+                if (triangleScore[adjacency[j]] > bestScore) {
+                    bestScore = triangleScore[adjacency[j]];
+                    bestTriangle = adjacency[j];
+                }
+        }
+    }
+
+    for (int i = 0; i < result.size(); i++)
+        indices[i] = result[i];
+}
+
+void MeshOptimizer::optimizeOverdraw(const QVector<Vertex>& vertices, QVector<uint32_t>& indices, float threshold) {
+    int triangleCount = indices.size() / 3;
+    if (triangleCount < 2) return;
+
+    // FIFO cache simulation: a vertex is cached if it missed within the last `simulatedCacheSize` misses
+    QVector<int> missTime(vertices.size(), INT_MIN / 2);
+    int time = 0;
+    QVector<int> misses(triangleCount);
+    for (int t = 0; t < triangleCount; t++) {
+        misses[t] = 0;
+        for (int k = 0; k < 3; k++) {
+            uint32_t v = indices[t * 3 + k];
+            if (time - missTime[v] > simulatedCacheSize) {
+                missTime[v] = time++;
+                misses[t]++;
+            }
+        }
+    }
+
+    // Hard boundaries are where the cache starts over anyway
+    QVector<int> hardClusters;
+    for (int t = 0; t < triangleCount; t++)
+        if (t == 0 || misses[t] == 3)
+            hardClusters.push_back(t);
+    hardClusters.push_back(triangleCount);
+
+    // Soft boundaries split a hard cluster once restarting with a cold cache is cheap enough
+    QVector<int> clusters;
+    for (int c = 0; c + 1 < hardClusters.size(); c++) {
+        int begin = hardClusters[c], end = hardClusters[c + 1];
+        int clusterMisses = 0;
+        for (int t = begin; t < end; t++)
+            clusterMisses += misses[t];
+        float clusterACMR = float(clusterMisses) / (end - begin);
+
+        time += simulatedCacheSize + 1; // flush the cache
+        int start = begin, runningMisses = 0;
+        clusters.push_back(begin);
+        for (int t = begin; t < end; t++) {
+            for (int k = 0; k < 3; k++) {
+                uint32_t v = indices[t * 3 + k];
+                if (time - missTime[v] > simulatedCacheSize) {
+                    missTime[v] = time++;
+                    runningMisses++;
+                }
+            }
+            if (t + 1 < end && float(runningMisses) / (t + 1 - start) <= threshold * clusterACMR) {
+                clusters.push_back(t + 1);
+                start = t + 1;
+                runningMisses = 0;
+                time += simulatedCacheSize + 1;
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+
+    // Sort the clusters so that the ones facing outwards are drawn first
+    QVector3D meshCentroid(0, 0, 0);
+    float meshArea = 0.0f;
+    QVector<QVector3D> clusterCentroids(clusters.size() - 1), clusterNormals(clusters.size() - 1);
+    for (int c = 0; c + 1 < clusters.size(); c++) {
+        QVector3D centroid(0, 0, 0), normal(0, 0, 0);
+        float area = 0.0f;
+        for (int t = clusters[c]; t < clusters[c + 1]; t++) {
+            QVector3D p0 = vertices[indices[t * 3 + 0]].position;
+            QVector3D p1 = vertices[indices[t * 3 + 1]].position;
+            QVector3D p2 = vertices[indices[t * 3 + 2]].position;
+            QVector3D n = QVector3D::crossProduct(p1 - p0, p2 - p0);
+            float a = n.length();
+            centroid += (p0 + p1 + p2) / 3 * a;
+            normal += n;
+            area += a;
+        }
+        meshCentroid += centroid;
+        meshArea += area;
+        clusterCentroids[c] = area > 0.0f ? centroid / area : centroid;
+        clusterNormals[c] = normal.normalized();
+    }
+    if (meshArea > 0.0f)
+        meshCentroid /= meshArea;
+
+    QVector<QPair<float, int>> order(clusters.size() - 1);
+    for (int c = 0; c < order.size(); c++)
+        order[c] = qMakePair(-QVector3D::dotProduct(clusterCentroids[c] - meshCentroid, clusterNormals[c]), c);
+    std::stable_sort(order.begin(), order.end());
+
+    QVector<uint32_t> result;
+    result.reserve(triangleCount * 3);
+    for (int i = 0; i < order.size(); i++) {
+        int c = order[i].second;
+        for (int j = clusters[c] * 3; j < clusters[c + 1] * 3; j++)
+            result.push_back(indices[j]);
+    }
+
+    for (int i = 0; i < result.size(); i++)
+        indices[i] = result[i];
+}
+
+void MeshOptimizer::optimizeVertexFetch(QVector<Vertex>& vertices, QVector<uint32_t>& indices) {
+    QVector<int> remap(vertices.size(), -1);
+    QVector<Vertex> result;
+    result.reserve(vertices.size());
+    for (int i = 0; i < indices.size(); i++) {
+        uint32_t v = indices[i];
+        if (remap[v] < 0) {
+            remap[v] = result.size();
+            result.push_back(vertices[v]);
+        }
+        indices[i] = uint32_t(remap[v]);
+    }
+    vertices = std::move(result);
+}
+
+void MeshOptimizer::buildMeshlets(Mesh * mesh, int maxVertices, int maxTriangles) {
+    if (!mesh) return;
+    if (mesh->meshType() != Mesh::Triangle) {
+        if (log_level >= LOG_LEVEL_WARNING)
+            dout << "Mesh" << mesh->objectName() << "is not a triangle mesh, skip meshlet building";
+        return;
+    }
+    QVector<uint32_t> indices = mesh->indices();
+    QVector<Meshlet> meshlets = buildMeshlets(mesh->vertices(), indices, maxVertices, maxTriangles);
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Split mesh" << mesh->objectName() << "into" << meshlets.size() << "meshlets";
+    mesh->setMeshlets(indices, meshlets);
+}
+
+QVector<Meshlet> MeshOptimizer::buildMeshlets(const QVector<Vertex>& vertices, QVector<uint32_t>& indices, int maxVertices, int maxTriangles) {
+    QVector<Meshlet> meshlets;
+    int triangleCount = indices.size() / 3, vertexCount = vertices.size();
+    if (triangleCount == 0) return meshlets;
+    maxVertices = qMax(maxVertices, 3);
+    maxTriangles = qMax(maxTriangles, 1);
+
+    QVector<int> adjacencyOffset(vertexCount + 1, 0);
+    for (int i = 0; i < triangleCount * 3; i++)
+        adjacencyOffset[indices[i] + 1]++;
+    for (int v = 0; v < vertexCount; v++)
+        adjacencyOffset[v + 1] += adjacencyOffset[v];
+    QVector<int> adjacency(triangleCount * 3);
+    QVector<int> fill = adjacencyOffset;
+    for (int t = 0; t < triangleCount; t++)
+        for (int k = 0; k < 3; k++)
+            adjacency[fill[indices[t * 3 + k]]++] = t;
+
+    QVector<bool> emitted(triangleCount, false);
+    QVector<int> owner(vertexCount, -1); // last meshlet using each vertex
+    QVector<int> candidates;
+    QVector<uint32_t> result;
+    result.reserve(triangleCount * 3);
+    int seed = 0;
+
+    while (result.size() < triangleCount * 3) {
+        // Seeds follow the input order, which keeps the locality of the previous passes
+        while (emitted[seed]) seed++;
+
+        int id = meshlets.size();
+        int usedVertices = 0, triangles = 0;
+        Meshlet meshlet;
+        meshlet.indexOffset = result.size();
+        candidates.clear();
+
+        int next = seed;
+        while (next >= 0) {
+            emitted[next] = true;
+            triangles++;
+            for (int k = 0; k < 3; k++) {
+                uint32_t v = indices[next * 3 + k];
+                result.push_back(v);
+                if (owner[v] != id) {
+                    owner[v] = id;
+                    usedVertices++;
+                    for (int j = adjacencyOffset[v]; j < adjacencyOffset[v + 1]; j++)
+                        if (!emitted[adjacency[j]])
+                            candidates.push_back(adjacency[j]);
+                }
+            }
+            if (triangles >= maxTriangles) break;
+
+            // Grow with the neighbour adding the fewest new vertices
+            next = -1;
+            int bestNew = 4, count = 0;
+            for (int i = 0; i < candidates.size(); i++) {
+                int t = candidates[i];
+                if (emitted[t]) continue;
+                candidates[count++] = t;
+                int newVertices = (owner[indices[t * 3 + 0]] != id) + (owner[indices[t * 3 + 1]] != id) + (owner[indices[t * 3 + 2]] != id);
+                if (newVertices < bestNew && usedVertices + newVertices <= maxVertices) {
+                    bestNew = newVertices;
+                    next = t;
+                }
+            }
+            candidates.resize(count);
+        }
+        meshlet.indexCount = result.size() - meshlet.indexOffset;
+
+        // Bounds of the cluster, centered on its box
+        AABB box;
+        for (int i = meshlet.indexOffset; i < result.size(); i++)
+            box.merge(vertices[result[i]].position);
+        float radius2 = 0.0f;
+        for (int i = meshlet.indexOffset; i < result.size(); i++)
+            radius2 = qMax(radius2, (vertices[result[i]].position - box.center()).lengthSquared());
+        meshlet.bounds = Sphere(box.center(), qSqrt(radius2));
+
+        // Normal cone from the face normals
+        QVector<QVector3D> normals;
+        QVector3D axis(0, 0, 0);
+        for (int i = meshlet.indexOffset; i < result.size(); i += 3) {
+            QVector3D p0 = vertices[result[i + 0]].position;
+            QVector3D p1 = vertices[result[i + 1]].position;
+            QVector3D p2 = vertices[result[i + 2]].position;
+            QVector3D n = QVector3D::crossProduct(p1 - p0, p2 - p0);
+            if (n.lengthSquared() < FLT_MIN) continue; // degenerated triangles face nowhere
+            normals.push_back(n.normalized());
+            axis += normals.back();
+        }
+        axis.normalize();
+        float minDot = 1.0f;
+        for (int i = 0; i < normals.size(); i++)
+            minDot = qMin(minDot, QVector3D::dotProduct(normals[i], axis));
+        if (normals.size() && !axis.isNull() && minDot > 0.0f) {
+            meshlet.coneAxis = axis;
+            meshlet.coneCutoff = qSqrt(1.0f - minDot * minDot);
+        }
+
+        meshlets.push_back(meshlet);
+    }
+
+    indices = result;
+    return meshlets;
+}
+
+float MeshOptimizer::computeACMR(const QVector<uint32_t>& indices, int vertexCount, int cacheSize) {
+    int triangleCount = indices.size() / 3;
+    if (triangleCount == 0) return 0.0f;
+
+    QVector<int> missTime(vertexCount, INT_MIN / 2);
+    int time = 0, misses = 0;
+    for (int i = 0; i < triangleCount * 3; i++)
+        if (time - missTime[indices[i]] > cacheSize) {
+            missTime[indices[i]] = time++;
+            misses++;
+        }
+    return float(misses) / triangleCount;
+}
@@ -0,0 +1,243 @@
+#include <MeshSimplifier.h>
+
+static const int maxPasses = 100;
+
+// A level is dropped if it keeps more than this fraction of the previous one
+static const float minReduction = 0.9f;
+
+// Sum of the squared distances to a set of planes, stored as a symmetric 4x4 matrix
+struct Quadric {
+    double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+
+    Quadric(): a2(0), ab(0), ac(0), ad(0), b2(0), bc(0), bd(0), c2(0), cd(0), d2(0) {}
+
+    // Plane ax + by + cz + d = 0, weighted by w
+    Quadric(double a, double b, double c, double d, double w):
+        a2(w * a * a), ab(w * a * b), ac(w * a * c), ad(w * a * d),
+        b2(w * b * b), bc(w * b * c), bd(w * b * d),
+        c2(w * c * c), cd(w * c * d), d2(w * d * d) {}
+
+    void operator+=(const Quadric& q) {
+        a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+        b2 += q.b2; bc += q.bc; bd += q.bd;
+        c2 += q.c2; cd += q.cd; d2 += q.d2;
+    }
+
+    double evaluate(const QVector3D& p) const {
+        double x = p.x(), y = p.y(), z = p.z();
+        return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x +
+               b2 * y * y + 2 * bc * y * z + 2 * bd * y +
+               c2 * z * z + 2 * cd * z + d2;
+    }
+};
+
+struct Collapse {
+    double cost;
+    uint32_t from, to;
+
+    bool operator<(const Collapse& collapse) const {
+        return cost < collapse.cost;
+    }
+};
+
+struct PositionLess {
+    const Vertex* vertices;
+
+    bool operator()(int a, int b) const {
+        const QVector3D& p = vertices[a].position;
+        const QVector3D& q = vertices[b].position;
+        if (p.x() != q.x()) return p.x() < q.x();
+        if (p.y() != q.y()) return p.y() < q.y();
+        return p.z() < q.z();
+    }
+};
+
+QVector<uint32_t> MeshSimplifier::simplify(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices, int targetIndexCount) {
+    QVector<uint32_t> result = indices;
+    int vertexCount = vertices.size();
+    if (result.size() <= targetIndexCount || vertexCount == 0) return result;
+
+    // Vertices at the same position are welded for the topology, `position` maps each
+    // vertex to the first one of its group. Groups of several vertices are seams.
+    QVector<int> order(vertexCount);
+    for (int i = 0; i < vertexCount; i++)
+        order[i] = i;
+    PositionLess less = { vertices.constData() };
+    std::sort(order.begin(), order.end(), less);
+
+    QVector<uint32_t> position(vertexCount);
+    QVector<bool> locked(vertexCount, false);
+    for (int i = 0; i < vertexCount;) {
+        int j = i + 1;
+        while (j < vertexCount && !less(order[i], order[j])) j++;
+        for (int k = i; k < j; k++)
+            position[order[k]] = uint32_t(order[i]);
+        locked[order[i]] = j - i > 1;
+        i = j;
+    }
+
+    // Edges that aren't shared by exactly two triangles are borders or non-manifold
+    QVector<quint64> edges;
+    edges.reserve(result.size());
+    for (int i = 0; i + 2 < result.size(); i += 3)
+        for (int k = 0; k < 3; k++) {
+            quint64 a = position[result[i + k]], b = position[result[i + (k + 1) % 3]];
+            edges.push_back(a < b ? (a << 32 | b) : (b << 32 | a));
+        }
+    std::sort(edges.begin(), edges.end());
+    for (int i = 0; i < edges.size();) {
+        int j = i + 1;
+        while (j < edges.size() && edges[j] == edges[i]) j++;
+        if (j - i != 2) {
+            locked[edges[i] >> 32] = true;
+            locked[edges[i] & 0xFFFFFFFF] = true;
+        }
+        i = j;
+    }
+
+    // Area weighted plane quadrics, accumulated per position
+    QVector<Quadric> quadrics(vertexCount);
+    for (int i = 0; i + 2 < result.size(); i += 3) {
+        QVector3D p0 = vertices[result[i + 0]].position;
+        QVector3D p1 = vertices[result[i + 1]].position;
+        QVector3D p2 = vertices[result[i + 2]].position;
+        QVector3D n = QVector3D::crossProduct(p1 - p0, p2 - p0);
+        float area = n.length();
+        if (area < FLT_MIN) continue;
+        n /= area;
+        Quadric q(n.x(), n.y(), n.z(), -QVector3D::dotProduct(n, p0), area * 0.5);
+        quadrics[position[result[i + 0]]] += q;
+        quadrics[position[result[i + 1]]] += q;
+        quadrics[position[result[i + 2]]] += q;
+    }
+
+    QVector<int> adjacencyOffset(vertexCount + 1);
+    QVector<int> adjacency, fill;
+    QVector<Collapse> collapses;
+    QVector<uint32_t> remap(vertexCount);
+    QVector<bool> touched(vertexCount);
+
+    for (int pass = 0; pass < maxPasses && result.size() > targetIndexCount; pass++) {
+        int triangleCount = result.size() / 3;
+
+        // Triangles around each vertex
+        adjacencyOffset.fill(0);
+        for (int i = 0; i < triangleCount * 3; i++)
+            adjacencyOffset[result[i] + 1]++;
+        for (int v = 0; v < vertexCount; v++)
+            adjacencyOffset[v + 1] += adjacencyOffset[v];
+        adjacency.resize(triangleCount * 3);
+        fill = adjacencyOffset;
+        for (int t = 0; t < triangleCount; t++)
+            for (int k = 0; k < 3; k++)
+                adjacency[fill[result[t * 3 + k]]++] = t;
+
+        // Both directions of every edge, a vertex only moves onto one of its neighbours
+        collapses.clear();
+        for (int t = 0; t < triangleCount; t++)
+            for (int k = 0; k < 3; k++) {
+                uint32_t a = result[t * 3 + k], b = result[t * 3 + (k + 1) % 3];
+                const QVector3D& pa = vertices[a].position;
+                const QVector3D& pb = vertices[b].position;
+                if (!locked[position[a]]) {
+                    Collapse collapse = { quadrics[position[a]].evaluate(pb) + quadrics[position[b]].evaluate(pb), a, b };
+                    collapses.push_back(collapse);
+                }
+                if (!locked[position[b]]) {
+                    Collapse collapse = { quadrics[position[a]].evaluate(pa) + quadrics[position[b]].evaluate(pa), b, a };
+                    collapses.push_back(collapse);
+                }
+            }
+        std::sort(collapses.begin(), collapses.end());
+
+        // Greedily take the cheapest collapses whose neighbourhoods don't overlap
+        for (int v = 0; v < vertexCount; v++)
+            remap[v] = uint32_t(v);
+        touched.fill(false);
+        int removable = triangleCount - targetIndexCount / 3, removed = 0;
+        for (int i = 0; i < collapses.size() && removed < removable; i++) {
+            uint32_t a = collapses[i].from, b = collapses[i].to;
+            if (touched[a] || touched[b]) continue;
+
+            bool valid = true;
+            int degenerated = 0;
+            for (int j = adjacencyOffset[a]; j < adjacencyOffset[a + 1] && valid; j++) {
+                const uint32_t* triangle = result.constData() + adjacency[j] * 3;
+                if (touched[triangle[0]] || touched[triangle[1]] || touched[triangle[2]]) {
+                    valid = false;
+                    break;
+                }
+                if (triangle[0] == b || triangle[1] == b || triangle[2] == b) {
+                    degenerated++;
+                    continue;
+                }
+
+                // Reject the collapse if a remaining triangle would flip over
+                QVector3D p[3], q[3];
+                for (int k = 0; k < 3; k++) {
+                    p[k] = vertices[triangle[k]].position;
+                    q[k] = triangle[k] == a ? vertices[b].position : p[k];
+                }
+                QVector3D n0 = QVector3D::crossProduct(p[1] - p[0], p[2] - p[0]);
+                QVector3D n1 = QVector3D::crossProduct(q[1] - q[0], q[2] - q[0]);
+                if (QVector3D::dotProduct(n0, n1) <= 0.0f)
+                    valid = false;
+            }
+            if (!valid) continue;
+
+            remap[a] = b;
+            quadrics[position[b]] += quadrics[position[a]];
+            for (int j = adjacencyOffset[a]; j < adjacencyOffset[a + 1]; j++) {
+                const uint32_t* triangle = result.constData() + adjacency[j] * 3;
+                touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = true;
+            }
+            touched[b] = true;
+            removed += degenerated;
+        }
+        if (removed == 0) break;
+
+        // Apply the collapses and drop the triangles that lost an edge
+        int count = 0;
+        for (int t = 0; t < triangleCount; t++) {
+            uint32_t i0 = remap[result[t * 3 + 0]];
+            uint32_t i1 = remap[result[t * 3 + 1]];
+            uint32_t i2 = remap[result[t * 3 + 2]];
+            if (position[i0] == position[i1] || position[i1] == position[i2] || position[i2] == position[i0])
+                continue;
+            result[count++] = i0;
+            result[count++] = i1;
+            result[count++] = i2;
+        }
+        result.resize(count);
+    }
+
+    return result;
+}
+
+void MeshSimplifier::generateLods(Mesh * mesh, int levelCount, float ratio) {
+    if (!mesh) return;
+    if (mesh->meshType() != Mesh::Triangle) {
+        if (log_level >= LOG_LEVEL_WARNING)
+            dout << "Mesh" << mesh->objectName() << "is not a triangle mesh, skip LOD generation";
+        return;
+    }
+
+    QVector<QVector<uint32_t>> lods;
+    QVector<uint32_t> source = mesh->indices();
+    for (int level = 1; level <= levelCount; level++) {
+        QVector<uint32_t> lod = simplify(mesh->vertices(), source, int(source.size() / 3 * ratio) * 3);
+        if (lod.size() == 0 || lod.size() > source.size() * minReduction)
+            break;
+        lods.push_back(lod);
+        source = lod;
+    }
+
+    if (log_level >= LOG_LEVEL_INFO) {
+        QString triangles = QString::number(mesh->indices().size() / 3);
+        for (int i = 0; i < lods.size(); i++)
+            triangles += " -> " + QString::number(lods[i].size() / 3);
+        dout << "Generated" << lods.size() << "LODs for mesh" << mesh->objectName() << ":" << triangles << "triangles";
+    }
+
+    mesh->setLodIndices(lods);
+}
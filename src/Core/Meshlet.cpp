@@ -0,0 +1,23 @@
+#include <Meshlet.h>
+
+Meshlet::Meshlet(): indexOffset(0), indexCount(0), coneAxis(0, 0, 1), coneCutoff(1.0f) {}
+
+bool Meshlet::isBackFacing(QVector3D viewPos) const {
+    if (coneCutoff >= 1.0f || bounds.isEmpty()) return false;
+    QVector3D d = bounds.center - viewPos;
+    return QVector3D::dotProduct(d, coneAxis) >= coneCutoff * d.length() + bounds.radius;
+}
+
+QDataStream &operator<<(QDataStream &out, const Meshlet& meshlet) {
+    out << meshlet.indexOffset << meshlet.indexCount;
+    out << meshlet.bounds.center << meshlet.bounds.radius;
+    out << meshlet.coneAxis << meshlet.coneCutoff;
+    return out;
+}
+
+QDataStream &operator>>(QDataStream &in, Meshlet& meshlet) {
+    in >> meshlet.indexOffset >> meshlet.indexCount;
+    in >> meshlet.bounds.center >> meshlet.bounds.radius;
+    in >> meshlet.coneAxis >> meshlet.coneCutoff;
+    return in;
+}
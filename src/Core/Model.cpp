@@ -1,199 +1,304 @@
-#include <Model.h>
-
-Model::Model(QObject * parent): AbstractEntity(0) {
-    setObjectName("Untitled model");
-    setParent(parent);
-}
-
-Model::Model(const Model & model): AbstractEntity(model) {
-    for (int i = 0; i < model.m_childMeshes.size(); i++)
-        addChildMesh(new Mesh(*model.m_childMeshes[i]));
-    for (int i = 0; i < model.m_childModels.size(); i++)
-        addChildModel(new Model(*model.m_childModels[i]));
-}
-
-Model::~Model() {
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << "Model" << this->objectName() << "is destroyed";
-}
-
-bool Model::addChildMesh(Mesh * mesh) {
-    if (!mesh || m_childMeshes.contains(mesh))
-        return false;
-
-    m_childMeshes.push_back(mesh);
-    mesh->setParent(this);
-    childMeshAdded(mesh);
-
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << "Mesh" << mesh->objectName() << "is added to model" << this->objectName() << "as child";
-
-    return true;
-}
-
-bool Model::addChildModel(Model * model) {
-    if (!model || m_childModels.contains(model))
-        return false;
-
-    m_childModels.push_back(model);
-    model->setParent(this);
-    childModelAdded(model);
-
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << "Model" << model->objectName() << "is added to model" << this->objectName() << "as child";
-
-    return true;
-}
-
-bool Model::removeChildMesh(QObject * mesh, bool recursive) {
-    for (int i = 0; i < m_childMeshes.size(); i++)
-        if (m_childMeshes[i] == mesh) {
-            m_childMeshes.erase(m_childMeshes.begin() + i);
-            childMeshRemoved(mesh);
-            if (log_level >= LOG_LEVEL_INFO)
-                dout << "Child mesh" << mesh->objectName() << "is removed from model" << this->objectName();
-            if (m_childMeshes.size() == 0 && m_childModels.size() == 0)
-                delete this;
-            return true;
-        }
-    if (!recursive) return false;
-    for (int i = 0; i < m_childModels.size(); i++)
-        if (m_childModels[i]->removeChildMesh(mesh, recursive))
-            return true;
-    return false;
-}
-
-bool Model::removeChildModel(QObject * model, bool recursive) {
-    for (int i = 0; i < m_childModels.size(); i++)
-        if (m_childModels[i] == model) {
-            m_childModels.erase(m_childModels.begin() + i);
-            childModelRemoved(model);
-            if (log_level >= LOG_LEVEL_INFO)
-                dout << "Child model" << model->objectName() << "is removed from model" << this->objectName();
-            if (m_childMeshes.size() == 0 && m_childModels.size() == 0)
-                delete this;
-            return true;
-        }
-    if (!recursive) return false;
-    for (int i = 0; i < m_childModels.size(); i++)
-        if (m_childModels[i]->removeChildModel(model, recursive))
-            return true;
-    return false;
-}
-
-// Dump info
-
-void Model::dumpObjectInfo(int l) {
-    qDebug().nospace() << tab(l) << "Model: " << objectName();
-    qDebug().nospace() << tab(l + 1) << "Visible: " << m_visible;
-    qDebug().nospace() << tab(l + 1) << "Position: " << m_position;
-    qDebug().nospace() << tab(l + 1) << "Rotation: " << m_rotation;
-    qDebug().nospace() << tab(l + 1) << "Scaling:  " << m_scaling;
-    qDebug("%s%d child mesh(es), %d child model(s)",
-           tab(l + 1), m_childMeshes.size(), m_childModels.size());
-}
-
-void Model::dumpObjectTree(int l) {
-    dumpObjectInfo(l);
-    for (int i = 0; i < m_childMeshes.size(); i++)
-        m_childMeshes[i]->dumpObjectTree(l + 1);
-    for (int i = 0; i < m_childModels.size(); i++)
-        m_childModels[i]->dumpObjectTree(l + 1);
-}
-
-bool Model::isGizmo() const {
-    return false;
-}
-
-bool Model::isLight() const {
-    return false;
-}
-
-bool Model::isMesh() const {
-    return false;
-}
-
-bool Model::isModel() const {
-    return true;
-}
-
-QVector3D Model::centerOfMass() const {
-    QVector3D centerOfMass;
-    float totalMass = 0;
-    for (int i = 0; i < m_childMeshes.size(); i++) {
-        centerOfMass += m_childMeshes[i]->centerOfMass() * m_childMeshes[i]->mass();
-        totalMass += m_childMeshes[i]->mass();
-    }
-    for (int i = 0; i < m_childModels.size(); i++) {
-        centerOfMass += m_childModels[i]->centerOfMass() * m_childModels[i]->mass();
-        totalMass += m_childModels[i]->mass();
-    }
-    return centerOfMass / totalMass;
-}
-
-float Model::mass() const {
-    float totalMass = 0;
-    for (int i = 0; i < m_childMeshes.size(); i++)
-        totalMass += m_childMeshes[i]->mass();
-    for (int i = 0; i < m_childModels.size(); i++)
-        totalMass += m_childModels[i]->mass();
-    return totalMass;
-}
-
-Mesh * Model::assemble() const {
-    Mesh* assembledMesh = 0;
-    for (int i = 0; i < m_childMeshes.size(); i++) {
-        Mesh* old = assembledMesh;
-        assembledMesh = Mesh::merge(old, m_childMeshes[i]);
-        if (old) delete old;
-    }
-    for (int i = 0; i < m_childModels.size(); i++) {
-        Mesh* old1 = assembledMesh;
-        Mesh* old2 = m_childModels[i]->assemble();
-        assembledMesh = Mesh::merge(old1, old2);
-        if (old1) delete old1;
-        if (old2) delete old2;
-    }
-    return assembledMesh;
-}
-
-const QVector<Mesh*>& Model::childMeshes() const {
-    return m_childMeshes;
-}
-
-const QVector<Model*>& Model::childModels() const {
-    return m_childModels;
-}
-
-void Model::reverseNormals() {
-    for (int i = 0; i < m_childMeshes.size(); i++)
-        m_childMeshes[i]->reverseNormals();
-    for (int i = 0; i < m_childModels.size(); i++)
-        m_childModels[i]->reverseNormals();
-}
-
-void Model::reverseTangents() {
-    for (int i = 0; i < m_childMeshes.size(); i++)
-        m_childMeshes[i]->reverseTangents();
-    for (int i = 0; i < m_childModels.size(); i++)
-        m_childModels[i]->reverseTangents();
-}
-
-void Model::reverseBitangents() {
-    for (int i = 0; i < m_childMeshes.size(); i++)
-        m_childMeshes[i]->reverseBitangents();
-    for (int i = 0; i < m_childModels.size(); i++)
-        m_childModels[i]->reverseBitangents();
-}
-
-void Model::childEvent(QChildEvent * e) {
-    if (e->added()) {
-        if (Model* model = qobject_cast<Model*>(e->child()))
-            addChildModel(model);
-        else if (Mesh* mesh = qobject_cast<Mesh*>(e->child()))
-            addChildMesh(mesh);
-    } else if (e->removed()) {
-        if (removeChildModel(e->child(), false)) return;
-        if (removeChildMesh(e->child(), false)) return;
-    }
-}
+#include <Model.h>
+
+Model::Model(QObject * parent): AbstractEntity(0) {
+    m_boundsDirty = true;
+    m_massDirty = true;
+    setObjectName("Untitled model");
+    setParent(parent);
+}
+
+Model::Model(const Model & model): AbstractEntity(model) {
+    m_boundsDirty = true;
+    m_massDirty = true;
+    for (int i = 0; i < model.m_childMeshes.size(); i++)
+        addChildMesh(new Mesh(*model.m_childMeshes[i]));
+    for (int i = 0; i < model.m_childModels.size(); i++)
+        addChildModel(new Model(*model.m_childModels[i]));
+}
+
+Model::~Model() {
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Model" << this->objectName() << "is destroyed";
+}
+
+bool Model::addChildMesh(Mesh * mesh) {
+    if (!mesh || m_childMeshes.contains(mesh))
+        return false;
+
+    m_childMeshes.push_back(mesh);
+    mesh->setParent(this);
+    connect(mesh, SIGNAL(positionChanged(QVector3D)), this, SLOT(invalidateBounds()));
+    connect(mesh, SIGNAL(rotationChanged(QVector3D)), this, SLOT(invalidateBounds()));
+    connect(mesh, SIGNAL(scalingChanged(QVector3D)), this, SLOT(invalidateBounds()));
+    connect(mesh, SIGNAL(geometryChanged(QVector<Vertex>, QVector<uint32_t>)), this, SLOT(invalidateBounds()));
+    connect(mesh, SIGNAL(verticesUpdated(int, int)), this, SLOT(invalidateBounds()));
+    connect(mesh, SIGNAL(meshTypeChanged(int)), this, SLOT(invalidateBounds()));
+    invalidateBounds();
+    childMeshAdded(mesh);
+
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Mesh" << mesh->objectName() << "is added to model" << this->objectName() << "as child";
+
+    return true;
+}
+
+bool Model::addChildModel(Model * model) {
+    if (!model || m_childModels.contains(model))
+        return false;
+
+    m_childModels.push_back(model);
+    model->setParent(this);
+    connect(model, SIGNAL(positionChanged(QVector3D)), this, SLOT(invalidateBounds()));
+    connect(model, SIGNAL(rotationChanged(QVector3D)), this, SLOT(invalidateBounds()));
+    connect(model, SIGNAL(scalingChanged(QVector3D)), this, SLOT(invalidateBounds()));
+    connect(model, SIGNAL(boundsChanged()), this, SLOT(invalidateBounds()));
+    invalidateBounds();
+    childModelAdded(model);
+
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Model" << model->objectName() << "is added to model" << this->objectName() << "as child";
+
+    return true;
+}
+
+bool Model::removeChildMesh(QObject * mesh, bool recursive) {
+    for (int i = 0; i < m_childMeshes.size(); i++)
+        if (m_childMeshes[i] == mesh) {
+            m_childMeshes.erase(m_childMeshes.begin() + i);
+            disconnect(mesh, 0, this, 0);
+            invalidateBounds();
+            childMeshRemoved(mesh);
+            if (log_level >= LOG_LEVEL_INFO)
+                dout << "Child mesh" << mesh->objectName() << "is removed from model" << this->objectName();
+            if (m_childMeshes.size() == 0 && m_childModels.size() == 0)
+                delete this;
+            return true;
+        }
+    if (!recursive) return false;
+    for (int i = 0; i < m_childModels.size(); i++)
+        if (m_childModels[i]->removeChildMesh(mesh, recursive))
+            return true;
+    return false;
+}
+
+bool Model::removeChildModel(QObject * model, bool recursive) {
+    for (int i = 0; i < m_childModels.size(); i++)
+        if (m_childModels[i] == model) {
+            m_childModels.erase(m_childModels.begin() + i);
+            disconnect(model, 0, this, 0);
+            invalidateBounds();
+            childModelRemoved(model);
+            if (log_level >= LOG_LEVEL_INFO)
+                dout << "Child model" << model->objectName() << "is removed from model" << this->objectName();
+            if (m_childMeshes.size() == 0 && m_childModels.size() == 0)
+                delete this;
+            return true;
+        }
+    if (!recursive) return false;
+    for (int i = 0; i < m_childModels.size(); i++)
+        if (m_childModels[i]->removeChildModel(model, recursive))
+            return true;
+    return false;
+}
+
+// Dump info
+
+void Model::dumpObjectInfo(int l) {
+    qDebug().nospace() << tab(l) << "Model: " << objectName();
+    qDebug().nospace() << tab(l + 1) << "Visible: " << m_visible;
+    qDebug().nospace() << tab(l + 1) << "Position: " << m_position;
+    qDebug().nospace() << tab(l + 1) << "Rotation: " << m_rotation;
+    qDebug().nospace() << tab(l + 1) << "Scaling:  " << m_scaling;
+    qDebug("%s%d child mesh(es), %d child model(s)",
+           tab(l + 1), m_childMeshes.size(), m_childModels.size());
+}
+
+void Model::dumpObjectTree(int l) {
+    dumpObjectInfo(l);
+    for (int i = 0; i < m_childMeshes.size(); i++)
+        m_childMeshes[i]->dumpObjectTree(l + 1);
+    for (int i = 0; i < m_childModels.size(); i++)
+        m_childModels[i]->dumpObjectTree(l + 1);
+}
+
+bool Model::isGizmo() const {
+    return false;
+}
+
+bool Model::isLight() const {
+    return false;
+}
+
+bool Model::isMesh() const {
+    return false;
+}
+
+bool Model::isModel() const {
+    return true;
+}
+
+QVector3D Model::centerOfMass() const {
+    float mass[3];
+    QVector3D moment[3];
+    massProperties(globalModelMatrix(), mass, moment);
+    float totalMass = mass[0] + mass[1] + mass[2];
+    if (totalMass > 0)
+        return (moment[0] + moment[1] + moment[2]) / totalMass;
+    return globalModelMatrix() * localBoundingBox().center();
+}
+
+float Model::mass() const {
+    float mass[3];
+    QVector3D moment[3];
+    massProperties(globalModelMatrix(), mass, moment);
+    return mass[0] + mass[1] + mass[2];
+}
+
+const AABB & Model::localBoundingBox() const {
+    if (m_boundsDirty) updateBounds();
+    return m_localBoundingBox;
+}
+
+const Sphere & Model::localBoundingSphere() const {
+    if (m_boundsDirty) updateBounds();
+    return m_localBoundingSphere;
+}
+
+AABB Model::boundingBox() const {
+    return globalModelMatrix() * localBoundingBox();
+}
+
+Sphere Model::boundingSphere() const {
+    return globalModelMatrix() * localBoundingSphere();
+}
+
+Mesh * Model::assemble() const {
+    QVector<const Mesh*> meshes;
+    collectMeshes(meshes);
+    return Mesh::merge(meshes);
+}
+
+void Model::collectMeshes(QVector<const Mesh*>& meshes) const {
+    for (int i = 0; i < m_childMeshes.size(); i++)
+        meshes.push_back(m_childMeshes[i]);
+    for (int i = 0; i < m_childModels.size(); i++)
+        m_childModels[i]->collectMeshes(meshes);
+}
+
+const QVector<Mesh*>& Model::childMeshes() const {
+    return m_childMeshes;
+}
+
+const QVector<Model*>& Model::childModels() const {
+    return m_childModels;
+}
+
+void Model::invalidateBounds() {
+    // Only notify on the first change, the parent is already dirty otherwise. The mass
+    // is refreshed without the bounds and the other way round, so both must be dirty.
+    if (m_boundsDirty && m_massDirty) return;
+    m_boundsDirty = true;
+    m_massDirty = true;
+    boundsChanged();
+}
+
+void Model::reverseNormals() {
+    for (int i = 0; i < m_childMeshes.size(); i++)
+        m_childMeshes[i]->reverseNormals();
+    for (int i = 0; i < m_childModels.size(); i++)
+        m_childModels[i]->reverseNormals();
+}
+
+void Model::reverseTangents() {
+    for (int i = 0; i < m_childMeshes.size(); i++)
+        m_childMeshes[i]->reverseTangents();
+    for (int i = 0; i < m_childModels.size(); i++)
+        m_childModels[i]->reverseTangents();
+}
+
+void Model::reverseBitangents() {
+    for (int i = 0; i < m_childMeshes.size(); i++)
+        m_childMeshes[i]->reverseBitangents();
+    for (int i = 0; i < m_childModels.size(); i++)
+        m_childModels[i]->reverseBitangents();
+}
+
+void Model::updateBounds() const {
+    m_localBoundingBox = AABB();
+    m_localBoundingSphere = Sphere();
+    for (int i = 0; i < m_childMeshes.size(); i++) {
+        QMatrix4x4 localModelMat = m_childMeshes[i]->localModelMatrix();
+        m_localBoundingBox.merge(localModelMat * m_childMeshes[i]->localBoundingBox());
+        m_localBoundingSphere.merge(localModelMat * m_childMeshes[i]->localBoundingSphere());
+    }
+    for (int i = 0; i < m_childModels.size(); i++) {
+        QMatrix4x4 localModelMat = m_childModels[i]->localModelMatrix();
+        m_localBoundingBox.merge(localModelMat * m_childModels[i]->localBoundingBox());
+        m_localBoundingSphere.merge(localModelMat * m_childModels[i]->localBoundingSphere());
+    }
+    m_boundsDirty = false;
+}
+
+void Model::updateMass() const {
+    for (int k = 0; k < 3; k++) {
+        m_localMass[k] = 0;
+        m_localMoment[k] = QVector3D(0, 0, 0);
+    }
+    accumulateMass(QMatrix4x4(), m_localMass, m_localMoment);
+    m_massDirty = false;
+}
+
+void Model::massProperties(const QMatrix4x4 & modelMat, float mass[3], QVector3D moment[3]) const {
+    if (!isSimilarity(modelMat)) {
+        // Lengths and areas don't scale uniformly, place the children one by one
+        for (int k = 0; k < 3; k++) {
+            mass[k] = 0;
+            moment[k] = QVector3D(0, 0, 0);
+        }
+        accumulateMass(modelMat, mass, moment);
+        return;
+    }
+    if (m_massDirty) updateMass();
+    for (int k = 0; k < 3; k++) {
+        if (m_localMass[k] > 0) {
+            mass[k] = m_localMass[k] * measureScale(modelMat, k);
+            moment[k] = (modelMat * (m_localMoment[k] / m_localMass[k])) * mass[k];
+        } else {
+            mass[k] = 0;
+            moment[k] = QVector3D(0, 0, 0);
+        }
+    }
+}
+
+void Model::accumulateMass(const QMatrix4x4 & modelMat, float mass[3], QVector3D moment[3]) const {
+    for (int i = 0; i < m_childMeshes.size(); i++) {
+        int k = m_childMeshes[i]->dimension();
+        float childMass;
+        QVector3D childMoment;
+        m_childMeshes[i]->massProperties(modelMat * m_childMeshes[i]->localModelMatrix(), childMass, childMoment);
+        mass[k] += childMass;
+        moment[k] += childMoment;
+    }
+    for (int i = 0; i < m_childModels.size(); i++) {
+        float childMass[3];
+        QVector3D childMoment[3];
+        m_childModels[i]->massProperties(modelMat * m_childModels[i]->localModelMatrix(), childMass, childMoment);
+        for (int k = 0; k < 3; k++) {
+            mass[k] += childMass[k];
+            moment[k] += childMoment[k];
+        }
+    }
+}
+
+void Model::childEvent(QChildEvent * e) {
+    AbstractEntity::childEvent(e);
+    if (e->added()) {
+        if (Model* model = qobject_cast<Model*>(e->child()))
+            addChildModel(model);
+        else if (Mesh* mesh = qobject_cast<Mesh*>(e->child()))
+            addChildMesh(mesh);
+    } else if (e->removed()) {
+        if (removeChildModel(e->child(), false)) return;
+        if (removeChildMesh(e->child(), false)) return;
+    }
+}
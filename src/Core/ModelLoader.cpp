@@ -1,200 +1,867 @@
-#include <ModelLoader.h>
-
-// Assimp: 3D model loader
-#include <assimp/Importer.hpp>
-#include <assimp/importerdesc.h>
-#include <assimp/scene.h>
-#include <assimp/postprocess.h>
-
-ModelLoader::ModelLoader() {
-    m_aiScenePtr = 0;
-}
-
-Model * ModelLoader::loadModelFromFile(QString filePath) {
-    if (filePath.length() == 0) {
-        m_log += "Filepath is empty.";
-        if (log_level >= LOG_LEVEL_ERROR)
-            dout << "Failed to load model: filepath is empty";
-        return 0;
-    }
-
-    Assimp::Importer importer;
-    unsigned int flags =
-        aiProcess_Triangulate |
-        aiProcess_CalcTangentSpace |
-        aiProcess_GenSmoothNormals |
-        aiProcess_JoinIdenticalVertices |
-        aiProcess_OptimizeGraph |
-        aiProcess_GenUVCoords;
-
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << "Loading" << filePath;
-
-    if (filePath[0] == ':') { // qrc
-        QFile file(filePath);
-        if (!file.open(QIODevice::ReadOnly)) {
-            if (log_level >= LOG_LEVEL_ERROR)
-                dout << "FATAL: failed to open internal file" << filePath;
-            exit(-1);
-        }
-
-        QByteArray bytes = file.readAll();
-        m_aiScenePtr = importer.ReadFileFromMemory(bytes.constData(), bytes.length(), flags);
-    } else {
-        m_dir = QFileInfo(filePath).absoluteDir();
-        m_aiScenePtr = importer.ReadFile(filePath.toStdString(), flags);
-    }
-
-    if (!m_aiScenePtr || !m_aiScenePtr->mRootNode || m_aiScenePtr->mFlags == AI_SCENE_FLAGS_INCOMPLETE) {
-        m_log += importer.GetErrorString();
-        if (log_level >= LOG_LEVEL_ERROR)
-            dout << importer.GetErrorString();
-        return 0;
-    }
-
-    Model* model = loadModel(m_aiScenePtr->mRootNode);
-    model->setObjectName(QFileInfo(filePath).baseName());
-
-    return model;
-}
-
-Mesh * ModelLoader::loadMeshFromFile(QString filePath) {
-    Model* model = loadModelFromFile(filePath);
-    Mesh* assembledMesh = model->assemble();
-    delete model;
-    return assembledMesh;
-}
-
-Model * ModelLoader::loadConeModel() {
-    static ModelLoader * loader = new ModelLoader;
-    Model* model = loader->loadModelFromFile(":/resources/shapes/Cone.obj");
-    return model;
-}
-
-Model * ModelLoader::loadCubeModel() {
-    static ModelLoader * loader = new ModelLoader;
-    Model* model = loader->loadModelFromFile(":/resources/shapes/Cube.obj");
-    return model;
-}
-
-Model * ModelLoader::loadCylinderModel() {
-    static ModelLoader * loader = new ModelLoader;
-    Model* model = loader->loadModelFromFile(":/resources/shapes/Cylinder.obj");
-    return model;
-}
-
-Model * ModelLoader::loadPlaneModel() {
-    static ModelLoader * loader = new ModelLoader;
-    Model* model = loader->loadModelFromFile(":/resources/shapes/Plane.obj");
-    return model;
-}
-
-Model * ModelLoader::loadSphereModel() {
-    static ModelLoader * loader = new ModelLoader;
-    Model* model = loader->loadModelFromFile(":/resources/shapes/Sphere.obj");
-    return model;
-}
-
-bool ModelLoader::hasErrorLog() {
-    return m_log.length() != 0 || textureLoader.hasErrorLog();
-}
-
-QString ModelLoader::errorLog() {
-    QString tmp = m_log + textureLoader.errorLog();
-    m_log = "";
-    return tmp;
-}
-
-Model * ModelLoader::loadModel(const aiNode * aiNodePtr) {
-    Model* model = new Model;
-    model->setObjectName(aiNodePtr->mName.length ? aiNodePtr->mName.C_Str() : "Untitled");
-    for (uint32_t i = 0; i < aiNodePtr->mNumMeshes; i++)
-        model->addChildMesh(loadMesh(m_aiScenePtr->mMeshes[aiNodePtr->mMeshes[i]]));
-    for (uint32_t i = 0; i < aiNodePtr->mNumChildren; i++)
-        model->addChildModel(loadModel(aiNodePtr->mChildren[i]));
-
-    QVector3D center = model->centerOfMass();
-
-    for (int i = 0; i < model->childMeshes().size(); i++)
-        model->childMeshes()[i]->translate(-center);
-    for (int i = 0; i < model->childModels().size(); i++)
-        model->childModels()[i]->translate(-center);
-
-    model->translate(center);
-
-    return model;
-}
-
-Mesh * ModelLoader::loadMesh(const aiMesh * aiMeshPtr) {
-    Mesh* mesh = new Mesh;
-    mesh->setObjectName(aiMeshPtr->mName.length ? aiMeshPtr->mName.C_Str() : "Untitled");
-
-    for (uint32_t i = 0; i < aiMeshPtr->mNumVertices; i++) {
-        Vertex vertex;
-        if (aiMeshPtr->HasPositions())
-            vertex.position = QVector3D(aiMeshPtr->mVertices[i].x, aiMeshPtr->mVertices[i].y, aiMeshPtr->mVertices[i].z);
-        if (aiMeshPtr->HasNormals())
-            vertex.normal = QVector3D(aiMeshPtr->mNormals[i].x, aiMeshPtr->mNormals[i].y, aiMeshPtr->mNormals[i].z);
-        if (aiMeshPtr->HasTangentsAndBitangents()) {
-            // Use left-handed tangent space
-            vertex.tangent = QVector3D(aiMeshPtr->mTangents[i].x, aiMeshPtr->mTangents[i].y, aiMeshPtr->mTangents[i].z);
-            vertex.bitangent = QVector3D(aiMeshPtr->mBitangents[i].x, aiMeshPtr->mBitangents[i].y, aiMeshPtr->mBitangents[i].z);
-
-            // Gram-Schmidt process, re-orthogonalize the TBN vectors
-            vertex.tangent -= QVector3D::dotProduct(vertex.tangent, vertex.normal) * vertex.normal;
-            vertex.tangent.normalize();
-
-            // Deal with mirrored texture coordinates
-            if (QVector3D::dotProduct(QVector3D::crossProduct(vertex.tangent, vertex.normal), vertex.bitangent) < 0.0f)
-                vertex.tangent = -vertex.tangent;
-        }
-        if (aiMeshPtr->HasTextureCoords(0))
-            vertex.texCoords = QVector2D(aiMeshPtr->mTextureCoords[0][i].x, aiMeshPtr->mTextureCoords[0][i].y);
-        mesh->m_vertices.push_back(vertex);
-    }
-
-    for (uint32_t i = 0; i < aiMeshPtr->mNumFaces; i++)
-        for (uint32_t j = 0; j < 3; j++)
-            mesh->m_indices.push_back(aiMeshPtr->mFaces[i].mIndices[j]);
-
-    QVector3D center = mesh->centerOfMass();
-
-    for (int i = 0; i < mesh->m_vertices.size(); i++)
-        mesh->m_vertices[i].position -= center;
-
-    mesh->m_position = center;
-    mesh->setMaterial(loadMaterial(m_aiScenePtr->mMaterials[aiMeshPtr->mMaterialIndex]));
-
-    return mesh;
-}
-
-Material * ModelLoader::loadMaterial(const aiMaterial * aiMaterialPtr) {
-    Material* material = new Material;
-    aiColor4D color; float value; aiString aiStr;
-
-    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_NAME, aiStr))
-        material->setObjectName(aiStr.length ? aiStr.C_Str() : "Untitled");
-    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_COLOR_AMBIENT, color))
-        material->setAmbient((color.r + color.g + color.b) / 3.0f);
-    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_COLOR_DIFFUSE, color)) {
-        material->setDiffuse((color.r + color.g + color.b) / 3.0f);
-        material->setColor(QVector3D(color.r, color.g, color.b) / material->diffuse());
-    }
-    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_COLOR_SPECULAR, color))
-        material->setSpecular((color.r + color.g + color.b) / 3.0f);
-    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_SHININESS, value) && !qFuzzyIsNull(value))
-        material->setShininess(value);
-    if (AI_SUCCESS == aiMaterialPtr->GetTexture(aiTextureType_DIFFUSE, 0, &aiStr)) {
-        QString filePath = m_dir.absolutePath() + '/' + QString(aiStr.C_Str()).replace('\\', '/');
-        material->setDiffuseTexture(textureLoader.loadFromFile(Texture::Diffuse, filePath));
-    }
-    if (AI_SUCCESS == aiMaterialPtr->GetTexture(aiTextureType_SPECULAR, 0, &aiStr)) {
-        QString filePath = m_dir.absolutePath() + '/' + QString(aiStr.C_Str()).replace('\\', '/');
-        material->setSpecularTexture(textureLoader.loadFromFile(Texture::Specular, filePath));
-    }
-    if (AI_SUCCESS == aiMaterialPtr->GetTexture(aiTextureType_HEIGHT, 0, &aiStr)) {
-        QString filePath = m_dir.absolutePath() + '/' + QString(aiStr.C_Str()).replace('\\', '/');
-        material->setBumpTexture(textureLoader.loadFromFile(Texture::Bump, filePath));
-    }
-    return material;
-}
+#include <ModelLoader.h>
+#include <ImportCache.h>
+#include <Primitive.h>
+#include <MappedIOSystem.h>
+#include <NativeModelReader.h>
+
+// Assimp: 3D model loader
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/importerdesc.h>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+#include <assimp/ProgressHandler.hpp>
+
+// Below this many vertices in a file the meshes are converted on the calling thread
+static const int parallelImportThreshold = 65536;
+
+// Share of the progress taken by Assimp, the rest is the conversion of the meshes
+static const int readProgress = 90;
+
+// Normals are only smoothed across edges flatter than this in the CAD profile
+static const float cadSmoothingAngle = 30.0f;
+
+// Formats whose importers already put out shared vertices, welding them again only
+// costs time
+static const char* indexedFormats[] = { "glb", "gltf", "ply" };
+
+static bool isIndexedFormat(QString filePath) {
+    QString suffix = QFileInfo(filePath).suffix().toLower();
+    for (size_t i = 0; i < sizeof(indexedFormats) / sizeof(indexedFormats[0]); i++)
+        if (suffix == indexedFormats[i])
+            return true;
+    return false;
+}
+
+// Same texture the material gets in loadMaterial
+static bool hasBumpTexture(const aiMaterial* aiMaterialPtr) {
+    return aiMaterialPtr->GetTextureCount(aiTextureType_HEIGHT) > 0;
+}
+
+// Cache entries are built in a QByteArray, which holds at most 2 GiB. This much is
+// left for everything but the vertices and indices.
+static const qint64 cacheEntryReserve = 64 << 20;
+
+// Bytes of the vertices and indices of all meshes, shared arrays counted every time
+static qint64 geometrySize(const Model* model) {
+    qint64 size = 0;
+    for (int i = 0; i < model->childMeshes().size(); i++) {
+        const Mesh* mesh = model->childMeshes()[i];
+        size += qint64(mesh->vertexCount()) * qint64(sizeof(Vertex));
+        for (int level = 0; level < mesh->lodCount(); level++)
+            size += qint64(mesh->lodIndices(level).size()) * qint64(sizeof(uint32_t));
+    }
+    for (int i = 0; i < model->childModels().size(); i++)
+        size += geometrySize(model->childModels()[i]);
+    return size;
+}
+
+static void applyStorageMode(Model* model, Mesh::StorageMode storageMode) {
+    for (int i = 0; i < model->childMeshes().size(); i++)
+        model->childMeshes()[i]->setStorageMode(storageMode);
+    for (int i = 0; i < model->childModels().size(); i++)
+        applyStorageMode(model->childModels()[i], storageMode);
+}
+
+// Forwards Assimp's progress to the future and aborts the import once it's canceled
+class ImportProgressHandler: public Assimp::ProgressHandler {
+public:
+    ImportProgressHandler(QFutureInterface<Model*>* future): m_future(future) {}
+
+    bool Update(float percentage) override {
+        if (percentage >= 0.0f)
+            m_future->setProgressValue(int(qBound(0.0f, percentage, 1.0f) * readProgress));
+        return !m_future->isCanceled();
+    }
+
+private:
+    QFutureInterface<Model*>* m_future;
+};
+
+class ImportTask: public QRunnable {
+public:
+    ImportTask(ModelLoader* owner, QString filePath): m_owner(owner), m_filePath(filePath) {
+        m_thread = QThread::currentThread();
+        m_loader.setMeshOptimization(owner->meshOptimization());
+        m_loader.setLodLevels(owner->lodLevels());
+        m_loader.setEnableMeshlets(owner->enableMeshlets());
+        m_loader.setImportProfile(owner->importProfile());
+        m_loader.setEnableNativeReaders(owner->enableNativeReaders());
+        m_loader.setStorageMode(owner->storageMode());
+        m_loader.m_future = &m_future;
+        m_future.setProgressRange(0, 100);
+        m_future.reportStarted();
+    }
+
+    QFuture<Model*> future() {
+        return m_future.future();
+    }
+
+    void run() override {
+        Model* model = 0;
+        if (!m_future.isCanceled())
+            model = m_loader.loadModelFromFile(m_filePath);
+
+        if (m_future.isCanceled()) {
+            delete model;
+            if (log_level >= LOG_LEVEL_INFO)
+                dout << "Canceled importing" << m_filePath;
+        } else {
+            QString log = m_loader.errorLog();
+            QMutexLocker locker(&m_owner->m_logMutex);
+            m_owner->m_log += log;
+            m_owner->m_importTimings.push_back(qMakePair(m_future.future(), m_loader.m_timings));
+            locker.unlock();
+            if (model) {
+                model->moveToThread(m_thread);
+                m_future.setProgressValue(100);
+                m_future.reportResult(model);
+            }
+        }
+        m_future.reportFinished();
+    }
+
+private:
+    ModelLoader* m_owner;
+    ModelLoader m_loader;
+    QString m_filePath;
+    QThread* m_thread;
+    QFutureInterface<Model*> m_future;
+};
+
+struct ModelLoader::MeshJob {
+    const aiMesh* aiMeshPtr;
+    int meshOptimization;
+    int lodLevels;
+    bool enableMeshlets;
+    bool tangents; // otherwise the mesh gets a layout without a tangent frame
+    QThread* thread; // the mesh is handed over to this thread when done
+    Mesh* mesh;
+    MeshOptimizer::Statistics optimization;
+};
+
+ModelLoader::ModelLoader() {
+    m_aiScenePtr = 0;
+    m_future = 0;
+    m_meshOptimization = MeshOptimizer::None;
+    m_lodLevels = 0;
+    m_enableMeshlets = false;
+    m_importProfile = FullQuality;
+    m_enableNativeReaders = true;
+    m_storageMode = Mesh::Interleaved;
+}
+
+ModelLoader::ImportTimings::ImportTimings():
+    cacheLookup(0), read(0), postProcess(0), convert(0), assemble(0), cacheStore(0), total(0),
+    cacheHit(false), optimizedTriangles(0), acmrBefore(0), acmrAfter(0) {}
+
+Model * ModelLoader::loadModelFromFile(QString filePath) {
+    if (filePath.length() == 0) {
+        m_log += "Filepath is empty.";
+        if (log_level >= LOG_LEVEL_ERROR)
+            dout << "Failed to load model: filepath is empty";
+        return 0;
+    }
+
+    unsigned int flags = postProcessFlags(filePath);
+    ImportTimings timings;
+    QElapsedTimer totalTimer, timer;
+    totalTimer.start();
+    timer.start();
+
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Loading" << filePath;
+
+    // Built in shapes aren't worth caching
+    QString cacheKey;
+    if (filePath[0] != ':') {
+        QByteArray options;
+        QDataStream(&options, QIODevice::WriteOnly) << qint32(m_importProfile) << flags
+            << m_meshOptimization << m_lodLevels << m_enableMeshlets << m_enableNativeReaders;
+        cacheKey = ImportCache::instance()->key(filePath, options);
+        if (QSharedPointer<ImportCache::Entry> entry = ImportCache::instance()->find(cacheKey)) {
+            Model* model = loadCachedModel(entry->bytes());
+            if (model) {
+                model->setObjectName(QFileInfo(filePath).baseName());
+                applyStorageMode(model, m_storageMode);
+                timings.cacheLookup = timings.total = timer.elapsed();
+                timings.cacheHit = true;
+                recordTimings(filePath, timings);
+                return model;
+            }
+            if (log_level >= LOG_LEVEL_WARNING)
+                dout << "Import cache entry of" << filePath << "is corrupt, importing again";
+        }
+    }
+    timings.cacheLookup = timer.restart();
+
+    if (filePath[0] == ':') { // qrc
+        if (!QFile::exists(filePath)) {
+            if (log_level >= LOG_LEVEL_ERROR)
+                dout << "FATAL: failed to open internal file" << filePath;
+            exit(-1);
+        }
+    } else
+        m_dir = QFileInfo(filePath).absoluteDir();
+
+    // Built in shapes and whatever the native readers turn down go through Assimp
+    Model* model = 0;
+    if (m_enableNativeReaders && filePath[0] != ':' && NativeModelReader::canRead(filePath))
+        model = loadNativeModel(filePath, timings, timer);
+    if (!model && !(m_future && m_future->isCanceled()))
+        model = loadAssimpModel(filePath, flags, timings, timer);
+    if (!model)
+        return 0;
+    model->setObjectName(QFileInfo(filePath).baseName());
+
+    if (!cacheKey.isEmpty() && geometrySize(model) >= INT_MAX - cacheEntryReserve) {
+        if (log_level >= LOG_LEVEL_WARNING)
+            dout << "Not caching" << filePath << ": its geometry doesn't fit in a cache entry";
+    } else if (!cacheKey.isEmpty()) {
+        ImportCache::instance()->insert(cacheKey, cacheModel(model));
+        timings.cacheStore = timer.restart();
+    }
+
+    // After caching, which reads the interleaved vertices
+    applyStorageMode(model, m_storageMode);
+
+    timings.total = totalTimer.elapsed();
+    recordTimings(filePath, timings);
+    return model;
+}
+
+Model * ModelLoader::loadAssimpModel(QString filePath, unsigned int flags, ImportTimings & timings, QElapsedTimer & timer) {
+    Assimp::Importer importer;
+    if (m_future)
+        importer.SetProgressHandler(new ImportProgressHandler(m_future)); // owned by the importer
+
+    // Files are mapped and resources read in place instead of buffered
+    importer.SetIOHandler(new MappedIOSystem); // owned by the importer
+    if (m_importProfile == CAD) {
+        importer.SetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, cadSmoothingAngle);
+        importer.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS, aiComponent_TEXCOORDS | aiComponent_TEXTURES |
+                                    aiComponent_TANGENTS_AND_BITANGENTS);
+    }
+
+    // Parsed without post-processing first, whether tangents are needed depends on
+    // the materials of the file
+    m_aiScenePtr = importer.ReadFile(filePath.toUtf8().constData(), 0);
+    timings.read = timer.restart();
+    if (m_aiScenePtr && m_importProfile == FastPreview)
+        for (uint32_t i = 0; i < m_aiScenePtr->mNumMaterials; i++)
+            if (hasBumpTexture(m_aiScenePtr->mMaterials[i])) {
+                flags |= aiProcess_CalcTangentSpace;
+                break;
+            }
+    if (m_aiScenePtr)
+        m_aiScenePtr = importer.ApplyPostProcessing(flags);
+    timings.postProcess = timer.restart();
+
+    if (!m_aiScenePtr || !m_aiScenePtr->mRootNode || m_aiScenePtr->mFlags == AI_SCENE_FLAGS_INCOMPLETE) {
+        m_log += importer.GetErrorString();
+        if (log_level >= LOG_LEVEL_ERROR)
+            dout << importer.GetErrorString();
+        return 0;
+    }
+
+    if (m_future)
+        m_future->setProgressValue(readProgress);
+    loadMeshes(timings);
+    timings.convert = timer.restart();
+    if (m_future && m_future->isCanceled()) {
+        for (int i = 0; i < m_meshes.size(); i++)
+            delete m_meshes[i];
+        m_meshes.clear();
+        return 0;
+    }
+
+    Model* model = loadModel(m_aiScenePtr->mRootNode);
+
+    // Meshes no node refers to
+    for (int i = 0; i < m_meshes.size(); i++)
+        if (!m_meshUsed[i])
+            delete m_meshes[i];
+    m_meshes.clear();
+    m_meshPositions.clear();
+    m_meshUsed.clear();
+    timings.assemble = timer.restart();
+    return model;
+}
+
+Model * ModelLoader::loadNativeModel(QString filePath, ImportTimings & timings, QElapsedTimer & timer) {
+    NativeModelReader reader;
+    reader.setIgnoreTexCoords(m_importProfile == CAD);
+    reader.setTangentMode(m_importProfile == FullQuality ? NativeModelReader::AllTangents :
+                          m_importProfile == FastPreview ? NativeModelReader::BumpMappedTangents :
+                          NativeModelReader::NoTangents);
+    if (m_importProfile == CAD)
+        reader.setMaxSmoothingAngle(cadSmoothingAngle);
+    reader.setFuture(m_future);
+
+    bool ok = reader.read(filePath);
+    timings.read = timer.restart();
+    if (!ok) {
+        if (m_future && m_future->isCanceled()) return 0;
+        timings.fallbackReason = reader.errorString();
+        if (log_level >= LOG_LEVEL_INFO)
+            dout << "Native reader turned down" << filePath << ":" << reader.errorString() << ", using Assimp";
+        return 0;
+    }
+    if (m_future)
+        m_future->setProgressValue(readProgress);
+
+    QVector<NativeModelReader::MeshData>& meshes = reader.meshes();
+    QVector<MeshJob> jobs(meshes.size());
+    for (int i = 0; i < jobs.size(); i++) {
+        Mesh* mesh = new Mesh;
+        mesh->setObjectName(meshes[i].name);
+        mesh->m_vertices.swap(meshes[i].vertices);
+        mesh->m_indices.swap(meshes[i].indices);
+        jobs[i].aiMeshPtr = 0;
+        jobs[i].tangents = meshes[i].tangents;
+        jobs[i].mesh = mesh;
+    }
+    runMeshJobs(jobs, timings);
+    timings.convert = timer.restart();
+    if (m_future && m_future->isCanceled()) {
+        for (int i = 0; i < m_meshes.size(); i++)
+            delete m_meshes[i];
+        m_meshes.clear();
+        return 0;
+    }
+
+    Model* model = new Model;
+    for (int i = 0; i < m_meshes.size(); i++) {
+        int material = meshes[i].material;
+        m_meshes[i]->setMaterial(loadMaterial(material >= 0 ? reader.materials()[material] : NativeModelReader::MaterialInfo()));
+        model->addChildMesh(m_meshes[i]);
+    }
+    centerChildren(model);
+    m_meshes.clear();
+    m_meshPositions.clear();
+    m_meshUsed.clear();
+    timings.assemble = timer.restart();
+    return model;
+}
+
+QFuture<Model*> ModelLoader::loadModelFromFileAsync(QString filePath) {
+    ImportTask* task = new ImportTask(this, filePath);
+    QFuture<Model*> future = task->future();
+    QThreadPool::globalInstance()->start(task);
+    return future;
+}
+
+Mesh * ModelLoader::loadMeshFromFile(QString filePath) {
+    Model* model = loadModelFromFile(filePath);
+    Mesh* assembledMesh = model->assemble();
+    delete model;
+    return assembledMesh;
+}
+
+int ModelLoader::meshOptimization() const {
+    return m_meshOptimization;
+}
+
+void ModelLoader::setMeshOptimization(int options) {
+    m_meshOptimization = options;
+}
+
+int ModelLoader::lodLevels() const {
+    return m_lodLevels;
+}
+
+void ModelLoader::setLodLevels(int levels) {
+    m_lodLevels = levels;
+}
+
+bool ModelLoader::enableMeshlets() const {
+    return m_enableMeshlets;
+}
+
+void ModelLoader::setEnableMeshlets(bool enabled) {
+    m_enableMeshlets = enabled;
+}
+
+ModelLoader::ImportProfile ModelLoader::importProfile() const {
+    return m_importProfile;
+}
+
+void ModelLoader::setImportProfile(ImportProfile profile) {
+    m_importProfile = profile;
+}
+
+bool ModelLoader::enableNativeReaders() const {
+    return m_enableNativeReaders;
+}
+
+void ModelLoader::setEnableNativeReaders(bool enabled) {
+    m_enableNativeReaders = enabled;
+}
+
+Mesh::StorageMode ModelLoader::storageMode() const {
+    return m_storageMode;
+}
+
+void ModelLoader::setStorageMode(Mesh::StorageMode storageMode) {
+    m_storageMode = storageMode;
+}
+
+ModelLoader::ImportTimings ModelLoader::lastImportTimings() {
+    return m_timings;
+}
+
+ModelLoader::ImportTimings ModelLoader::takeImportTimings(const QFuture<Model*>& future) {
+    QMutexLocker locker(&m_logMutex);
+    for (int i = 0; i < m_importTimings.size(); i++)
+        if (m_importTimings[i].first == future) {
+            ImportTimings timings = m_importTimings[i].second;
+            m_importTimings.remove(i);
+            return timings;
+        }
+    return ImportTimings();
+}
+
+// Built in shapes are generated once and shared, see Primitive
+static Model* primitiveModel(Mesh* mesh) {
+    Model* model = new Model;
+    model->setObjectName(mesh->objectName());
+    model->addChildMesh(mesh);
+    return model;
+}
+
+Model * ModelLoader::loadConeModel(int segments) {
+    return primitiveModel(Primitive::cone(segments));
+}
+
+Model * ModelLoader::loadCubeModel() {
+    return primitiveModel(Primitive::cube());
+}
+
+Model * ModelLoader::loadCylinderModel(int segments) {
+    return primitiveModel(Primitive::cylinder(segments));
+}
+
+Model * ModelLoader::loadPlaneModel(int divisions) {
+    return primitiveModel(Primitive::plane(divisions));
+}
+
+Model * ModelLoader::loadSphereModel(int segments, int rings) {
+    return primitiveModel(Primitive::sphere(segments, rings));
+}
+
+bool ModelLoader::hasErrorLog() {
+    QMutexLocker locker(&m_logMutex);
+    return m_log.length() != 0 || textureLoader.hasErrorLog();
+}
+
+QString ModelLoader::errorLog() {
+    QMutexLocker locker(&m_logMutex);
+    QString tmp = m_log + textureLoader.errorLog();
+    m_log = "";
+    return tmp;
+}
+
+// Assimp post-processing of a profile. Tangents of the fast preview are added once
+// the materials are known, see loadModelFromFile.
+unsigned int ModelLoader::postProcessFlags(QString filePath) const {
+    unsigned int flags = aiProcess_Triangulate | aiProcess_GenSmoothNormals;
+    switch (m_importProfile) {
+    case FullQuality:
+        flags |= aiProcess_CalcTangentSpace | aiProcess_JoinIdenticalVertices |
+                 aiProcess_OptimizeGraph | aiProcess_GenUVCoords;
+        break;
+    case FastPreview:
+        break;
+    case CAD:
+        // The node tree is the assembly structure, so it isn't flattened
+        flags |= aiProcess_RemoveComponent | aiProcess_JoinIdenticalVertices;
+        break;
+    }
+    if (isIndexedFormat(filePath))
+        flags &= ~aiProcess_JoinIdenticalVertices;
+    return flags;
+}
+
+void ModelLoader::recordTimings(QString filePath, const ImportTimings & timings) {
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Imported" << filePath << "in" << timings.total << "ms: cache lookup" << timings.cacheLookup
+             << "ms, read" << timings.read << "ms, post-processing" << timings.postProcess
+             << "ms, conversion" << timings.convert << "ms, assembly" << timings.assemble
+             << "ms, cache store" << timings.cacheStore << "ms";
+    if (log_level >= LOG_LEVEL_INFO && timings.optimizedTriangles > 0)
+        dout << "Optimized" << timings.optimizedTriangles << "triangles of" << filePath
+             << ", ACMR" << timings.acmrBefore << "->" << timings.acmrAfter;
+    m_timings = timings;
+}
+
+// Convert every mesh of the scene up front, see runMeshJobs
+void ModelLoader::loadMeshes(ImportTimings& timings) {
+    QVector<MeshJob> jobs(m_aiScenePtr->mNumMeshes);
+    for (int i = 0; i < jobs.size(); i++) {
+        jobs[i].aiMeshPtr = m_aiScenePtr->mMeshes[i];
+        // Materials can be changed in the editor later, full quality always keeps them
+        jobs[i].tangents = m_importProfile == FullQuality ||
+            (m_importProfile == FastPreview && hasBumpTexture(m_aiScenePtr->mMaterials[jobs[i].aiMeshPtr->mMaterialIndex]));
+        jobs[i].mesh = 0;
+    }
+    runMeshJobs(jobs, timings);
+}
+
+// Spread across the global thread pool. The meshes come back without a parent and
+// are placed into models afterwards.
+void ModelLoader::runMeshJobs(QVector<MeshJob>& jobs, ImportTimings& timings) {
+    bool preview = m_importProfile == FastPreview;
+    int vertexCount = 0;
+    for (int i = 0; i < jobs.size(); i++) {
+        jobs[i].meshOptimization = preview ? int(MeshOptimizer::None) : m_meshOptimization;
+        jobs[i].lodLevels = preview ? 0 : m_lodLevels;
+        jobs[i].enableMeshlets = preview ? false : m_enableMeshlets;
+        jobs[i].thread = QThread::currentThread();
+        jobs[i].optimization.triangles = 0;
+        jobs[i].optimization.acmrBefore = jobs[i].optimization.acmrAfter = 0;
+        vertexCount += jobs[i].aiMeshPtr ? int(jobs[i].aiMeshPtr->mNumVertices) : jobs[i].mesh->m_vertices.size();
+    }
+
+    if (jobs.size() > 1 && vertexCount >= parallelImportThreshold) {
+        if (log_level >= LOG_LEVEL_INFO)
+            dout << "Converting" << jobs.size() << "meshes on" << QThreadPool::globalInstance()->maxThreadCount() << "threads";
+        QtConcurrent::blockingMap(jobs, loadMesh);
+    } else
+        for (int i = 0; i < jobs.size(); i++)
+            loadMesh(jobs[i]);
+
+    m_meshes.resize(jobs.size());
+    m_meshPositions.resize(jobs.size());
+    m_meshUsed.fill(false, jobs.size());
+    double acmrBefore = 0, acmrAfter = 0;
+    int triangles = 0;
+    for (int i = 0; i < jobs.size(); i++) {
+        m_meshes[i] = jobs[i].mesh;
+        m_meshPositions[i] = jobs[i].mesh->position();
+        const MeshOptimizer::Statistics& optimization = jobs[i].optimization;
+        if (optimization.acmrBefore > 0) {
+            acmrBefore += double(optimization.acmrBefore) * optimization.triangles;
+            acmrAfter += double(optimization.acmrAfter) * optimization.triangles;
+            triangles += optimization.triangles;
+        }
+    }
+    if (triangles > 0) {
+        timings.optimizedTriangles = triangles;
+        timings.acmrBefore = float(acmrBefore / triangles);
+        timings.acmrAfter = float(acmrAfter / triangles);
+    }
+}
+
+Model * ModelLoader::loadModel(const aiNode * aiNodePtr) {
+    Model* model = new Model;
+    model->setObjectName(aiNodePtr->mName.length ? aiNodePtr->mName.C_Str() : "Untitled");
+    for (uint32_t i = 0; i < aiNodePtr->mNumMeshes; i++)
+        model->addChildMesh(takeMesh(aiNodePtr->mMeshes[i]));
+    for (uint32_t i = 0; i < aiNodePtr->mNumChildren; i++)
+        model->addChildModel(loadModel(aiNodePtr->mChildren[i]));
+
+    centerChildren(model);
+    return model;
+}
+
+// Move the model to the center of mass of its children, keeping them in place
+void ModelLoader::centerChildren(Model * model) {
+    QVector3D center = model->centerOfMass();
+
+    for (int i = 0; i < model->childMeshes().size(); i++)
+        model->childMeshes()[i]->translate(-center);
+    for (int i = 0; i < model->childModels().size(); i++)
+        model->childModels()[i]->translate(-center);
+
+    model->translate(center);
+}
+
+// A mesh referred to by several nodes is copied, the copies share its arrays
+Mesh * ModelLoader::takeMesh(uint32_t index) {
+    Mesh* mesh = m_meshes[index];
+    if (m_meshUsed[index]) {
+        // The original may have been moved by its model already
+        Mesh* copy = new Mesh(*mesh);
+        copy->setPosition(m_meshPositions[index]);
+        return copy;
+    }
+    m_meshUsed[index] = true;
+    mesh->setMaterial(loadMaterial(m_aiScenePtr->mMaterials[m_aiScenePtr->mMeshes[index]->mMaterialIndex]));
+    return mesh;
+}
+
+void ModelLoader::loadMesh(MeshJob & job) {
+    // Meshes of the native readers come with their arrays filled in
+    Mesh* mesh = job.aiMeshPtr ? convertMesh(job.aiMeshPtr, job.tangents) : job.mesh;
+    if (!job.tangents)
+        mesh->m_vertexLayout |= VertexLayout::NoTangents;
+
+    if (job.meshOptimization != MeshOptimizer::None)
+        job.optimization = MeshOptimizer::optimize(mesh->m_vertices, mesh->m_indices, job.meshOptimization);
+
+    QVector3D center = mesh->localCenterOfMass();
+
+    for (int i = 0; i < mesh->m_vertices.size(); i++)
+        mesh->m_vertices[i].position -= center;
+
+    mesh->updateBounds();
+    mesh->m_localCenterOfMass -= center;
+    mesh->m_position = center;
+    mesh->invalidateTransform();
+
+    if (job.enableMeshlets)
+        MeshOptimizer::buildMeshlets(mesh);
+    if (job.lodLevels > 0)
+        MeshSimplifier::generateLods(mesh, job.lodLevels);
+
+    // Objects can only be pushed to another thread by their own one
+    mesh->moveToThread(job.thread);
+    job.mesh = mesh;
+}
+
+Mesh * ModelLoader::convertMesh(const aiMesh * aiMeshPtr, bool tangents) {
+    Mesh* mesh = new Mesh;
+    mesh->setObjectName(aiMeshPtr->mName.length ? aiMeshPtr->mName.C_Str() : "Untitled");
+
+    // One pass per attribute over the presized array, aiVector3D and QVector3D are
+    // both three packed floats
+    int vertexCount = int(aiMeshPtr->mNumVertices);
+    mesh->m_vertices.resize(vertexCount);
+    Vertex* vertices = mesh->m_vertices.data();
+    if (aiMeshPtr->HasPositions())
+        for (int i = 0; i < vertexCount; i++)
+            memcpy(&vertices[i].position, &aiMeshPtr->mVertices[i], sizeof(QVector3D));
+    if (aiMeshPtr->HasNormals())
+        for (int i = 0; i < vertexCount; i++)
+            memcpy(&vertices[i].normal, &aiMeshPtr->mNormals[i], sizeof(QVector3D));
+    if (tangents && aiMeshPtr->HasTangentsAndBitangents()) {
+        // Use left-handed tangent space
+        for (int i = 0; i < vertexCount; i++) {
+            memcpy(&vertices[i].tangent, &aiMeshPtr->mTangents[i], sizeof(QVector3D));
+            memcpy(&vertices[i].bitangent, &aiMeshPtr->mBitangents[i], sizeof(QVector3D));
+        }
+        orthogonalizeTangents(vertices, vertexCount);
+    }
+    if (aiMeshPtr->HasTextureCoords(0))
+        for (int i = 0; i < vertexCount; i++)
+            memcpy(&vertices[i].texCoords, &aiMeshPtr->mTextureCoords[0][i], sizeof(QVector2D));
+
+    mesh->m_indices.resize(int(aiMeshPtr->mNumFaces) * 3);
+    uint32_t* indices = mesh->m_indices.data();
+    for (uint32_t i = 0; i < aiMeshPtr->mNumFaces; i++, indices += 3)
+        memcpy(indices, aiMeshPtr->mFaces[i].mIndices, 3 * sizeof(uint32_t));
+    return mesh;
+}
+
+// Layout of the import cache entries. Arrays are stored as raw bytes so that loading
+// them from the mapped entry is a plain copy, meshes sharing their arrays are stored
+// once. Textures are referred to by path and go through the texture loader.
+QByteArray ModelLoader::cacheModel(Model * model) {
+    QByteArray bytes;
+    QDataStream out(&bytes, QIODevice::WriteOnly);
+    QHash<quint64, int> geometries;
+    int meshCount = 0;
+    cacheModel(model, out, geometries, meshCount);
+    return bytes;
+}
+
+void ModelLoader::cacheModel(Model * model, QDataStream & out, QHash<quint64, int>& geometries, int& meshCount) {
+    out << model->objectName() << model->position() << model->rotation() << model->scaling();
+    out << model->childMeshes().size();
+    for (int i = 0; i < model->childMeshes().size(); i++)
+        cacheMesh(model->childMeshes()[i], out, geometries, meshCount);
+    out << model->childModels().size();
+    for (int i = 0; i < model->childModels().size(); i++)
+        cacheModel(model->childModels()[i], out, geometries, meshCount);
+}
+
+void ModelLoader::cacheMesh(Mesh * mesh, QDataStream & out, QHash<quint64, int>& geometries, int& meshCount) {
+    out << mesh->objectName() << mesh->meshType() << mesh->vertexLayout() << mesh->position() << mesh->rotation() << mesh->scaling();
+
+    // Index of an earlier mesh with the same arrays, or -1 if they follow
+    out << geometries.value(mesh->geometryId(), -1);
+    if (!geometries.contains(mesh->geometryId())) {
+        geometries[mesh->geometryId()] = meshCount;
+        const QVector<Vertex>& vertices = mesh->vertices();
+        out << vertices.size();
+        out.writeRawData(reinterpret_cast<const char*>(vertices.constData()), vertices.size() * int(sizeof(Vertex)));
+        out << mesh->lodCount();
+        for (int level = 0; level < mesh->lodCount(); level++) {
+            const QVector<uint32_t>& indices = mesh->lodIndices(level);
+            out << indices.size();
+            out.writeRawData(reinterpret_cast<const char*>(indices.constData()), indices.size() * int(sizeof(uint32_t)));
+        }
+        out << mesh->meshlets();
+    }
+    meshCount++;
+
+    Material* material = mesh->material();
+    out << bool(material != 0);
+    if (material) {
+        out << material->objectName() << material->color() << material->ambient()
+            << material->diffuse() << material->specular() << material->shininess();
+        out << (material->diffuseTexture() ? material->diffuseTexture()->objectName() : QString());
+        out << (material->specularTexture() ? material->specularTexture()->objectName() : QString());
+        out << (material->bumpTexture() ? material->bumpTexture()->objectName() : QString());
+    }
+}
+
+Model * ModelLoader::loadCachedModel(const QByteArray & bytes) {
+    QDataStream in(bytes);
+    QVector<Mesh*> meshes;
+    Model* model = loadCachedModel(in, meshes);
+    if (in.status() != QDataStream::Ok) {
+        delete model;
+        return 0;
+    }
+    return model;
+}
+
+Model * ModelLoader::loadCachedModel(QDataStream & in, QVector<Mesh*>& meshes) {
+    Model* model = new Model;
+    QString name; QVector3D position, rotation, scaling;
+    in >> name >> position >> rotation >> scaling;
+    model->setObjectName(name);
+
+    int meshCount, modelCount;
+    in >> meshCount;
+    for (int i = 0; i < meshCount && in.status() == QDataStream::Ok; i++)
+        model->addChildMesh(loadCachedMesh(in, meshes));
+    in >> modelCount;
+    for (int i = 0; i < modelCount && in.status() == QDataStream::Ok; i++)
+        model->addChildModel(loadCachedModel(in, meshes));
+
+    model->setPosition(position);
+    model->setRotation(rotation);
+    model->setScaling(scaling);
+    return model;
+}
+
+Mesh * ModelLoader::loadCachedMesh(QDataStream & in, QVector<Mesh*>& meshes) {
+    Mesh* mesh = new Mesh;
+    QString name; Mesh::MeshType meshType; QVector3D rotation, scaling;
+    in >> name >> meshType >> mesh->m_vertexLayout >> mesh->m_position >> rotation >> scaling;
+    mesh->setObjectName(name);
+    mesh->m_meshType = meshType;
+    mesh->m_rotation = rotation;
+    mesh->m_scaling = scaling;
+    mesh->invalidateTransform();
+
+    int shared;
+    in >> shared;
+    if (shared >= 0 && shared < meshes.size()) {
+        const Mesh* source = meshes[shared];
+        mesh->m_vertices = source->m_vertices;
+        mesh->m_indices = source->m_indices;
+        mesh->m_lodIndices = source->m_lodIndices;
+        mesh->m_meshlets = source->m_meshlets;
+        mesh->m_geometryId = source->m_geometryId;
+        mesh->m_localBoundingBox = source->m_localBoundingBox;
+        mesh->m_localBoundingSphere = source->m_localBoundingSphere;
+    } else {
+        int vertexCount = 0, lodCount = 0;
+        in >> vertexCount;
+        if (vertexCount < 0 || qint64(vertexCount) * int(sizeof(Vertex)) > in.device()->bytesAvailable()) {
+            in.setStatus(QDataStream::ReadCorruptData);
+            return mesh;
+        }
+        mesh->m_vertices.resize(vertexCount);
+        in.readRawData(reinterpret_cast<char*>(mesh->m_vertices.data()), vertexCount * int(sizeof(Vertex)));
+        in >> lodCount;
+        for (int level = 0; level < lodCount && in.status() == QDataStream::Ok; level++) {
+            int indexCount = 0;
+            in >> indexCount;
+            if (indexCount < 0 || qint64(indexCount) * int(sizeof(uint32_t)) > in.device()->bytesAvailable()) {
+                in.setStatus(QDataStream::ReadCorruptData);
+                return mesh;
+            }
+            QVector<uint32_t> indices(indexCount);
+            in.readRawData(reinterpret_cast<char*>(indices.data()), indexCount * int(sizeof(uint32_t)));
+            if (level == 0)
+                mesh->m_indices = indices;
+            else
+                mesh->m_lodIndices.push_back(indices);
+        }
+        in >> mesh->m_meshlets;
+        mesh->updateBounds();
+    }
+    meshes.push_back(mesh);
+
+    bool hasMaterial;
+    in >> hasMaterial;
+    if (hasMaterial) {
+        Material* material = new Material;
+        QString name, diffuseTexture, specularTexture, bumpTexture;
+        QVector3D color; float ambient, diffuse, specular, shininess;
+        in >> name >> color >> ambient >> diffuse >> specular >> shininess;
+        in >> diffuseTexture >> specularTexture >> bumpTexture;
+        material->setObjectName(name);
+        material->setColor(color);
+        material->setAmbient(ambient);
+        material->setDiffuse(diffuse);
+        material->setSpecular(specular);
+        material->setShininess(shininess);
+        if (!diffuseTexture.isEmpty())
+            material->setDiffuseTexture(textureLoader.loadFromFile(Texture::Diffuse, diffuseTexture));
+        if (!specularTexture.isEmpty())
+            material->setSpecularTexture(textureLoader.loadFromFile(Texture::Specular, specularTexture));
+        if (!bumpTexture.isEmpty())
+            material->setBumpTexture(textureLoader.loadFromFile(Texture::Bump, bumpTexture));
+        mesh->setMaterial(material);
+    }
+    return mesh;
+}
+
+Material * ModelLoader::loadMaterial(const aiMaterial * aiMaterialPtr) {
+    Material* material = new Material;
+    aiColor4D color; float value; aiString aiStr;
+
+    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_NAME, aiStr))
+        material->setObjectName(aiStr.length ? aiStr.C_Str() : "Untitled");
+    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_COLOR_AMBIENT, color))
+        material->setAmbient((color.r + color.g + color.b) / 3.0f);
+    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_COLOR_DIFFUSE, color)) {
+        material->setDiffuse((color.r + color.g + color.b) / 3.0f);
+        material->setColor(QVector3D(color.r, color.g, color.b) / material->diffuse());
+    }
+    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_COLOR_SPECULAR, color))
+        material->setSpecular((color.r + color.g + color.b) / 3.0f);
+    if (AI_SUCCESS == aiMaterialPtr->Get(AI_MATKEY_SHININESS, value) && !qFuzzyIsNull(value))
+        material->setShininess(value);
+    if (m_importProfile == CAD)
+        return material;
+    if (AI_SUCCESS == aiMaterialPtr->GetTexture(aiTextureType_DIFFUSE, 0, &aiStr))
+        material->setDiffuseTexture(textureLoader.loadFromFile(Texture::Diffuse, texturePath(aiStr.C_Str())));
+    if (AI_SUCCESS == aiMaterialPtr->GetTexture(aiTextureType_SPECULAR, 0, &aiStr))
+        material->setSpecularTexture(textureLoader.loadFromFile(Texture::Specular, texturePath(aiStr.C_Str())));
+    if (AI_SUCCESS == aiMaterialPtr->GetTexture(aiTextureType_HEIGHT, 0, &aiStr))
+        material->setBumpTexture(textureLoader.loadFromFile(Texture::Bump, texturePath(aiStr.C_Str())));
+    return material;
+}
+
+// Same conversion as for Assimp's materials above
+Material * ModelLoader::loadMaterial(const NativeModelReader::MaterialInfo & info) {
+    Material* material = new Material;
+    material->setObjectName(info.name.length() ? info.name : "Untitled");
+    material->setAmbient((info.ambient.x() + info.ambient.y() + info.ambient.z()) / 3.0f);
+    material->setDiffuse((info.diffuse.x() + info.diffuse.y() + info.diffuse.z()) / 3.0f);
+    if (material->diffuse() > 0.0f)
+        material->setColor(info.diffuse / material->diffuse());
+    material->setSpecular((info.specular.x() + info.specular.y() + info.specular.z()) / 3.0f);
+    if (!qFuzzyIsNull(info.shininess))
+        material->setShininess(info.shininess);
+    if (m_importProfile == CAD)
+        return material;
+    if (!info.diffuseTexture.isEmpty())
+        material->setDiffuseTexture(textureLoader.loadFromFile(Texture::Diffuse, texturePath(info.diffuseTexture)));
+    if (!info.specularTexture.isEmpty())
+        material->setSpecularTexture(textureLoader.loadFromFile(Texture::Specular, texturePath(info.specularTexture)));
+    if (!info.bumpTexture.isEmpty())
+        material->setBumpTexture(textureLoader.loadFromFile(Texture::Bump, texturePath(info.bumpTexture)));
+    return material;
+}
+
+// Texture paths are relative to the model file
+QString ModelLoader::texturePath(QString path) const {
+    return m_dir.absolutePath() + '/' + path.replace('\\', '/');
+}
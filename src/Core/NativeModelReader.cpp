@@ -0,0 +1,1235 @@
+#include <NativeModelReader.h>
+
+// Text is cut into chunks of about this many bytes, at line ends
+static const qint64 textChunkSize = 4 << 20;
+
+// Binary records are decoded this many at a time
+static const int recordChunkSize = 1 << 18;
+
+// At or above this angle every normal is simply averaged, as Assimp does
+static const float smoothAllAngle = 175.0f;
+
+static const float pi = 3.14159265358979f;
+
+// Qt's containers hold at most 2 GiB
+static inline bool fitsInArray(qint64 count, size_t elementSize) {
+    return count * qint64(elementSize) < INT_MAX - 1024;
+}
+
+// Unindexed STL and OBJ meshes larger than this are split into parts, about 12.8M
+// triangles each
+static const int maxPartTriangles = int((INT_MAX - 1024) / (3 * sizeof(Vertex)));
+
+template <typename T>
+static void runChunks(QVector<T>& chunks, void (*function)(T&)) {
+    if (chunks.size() > 1)
+        QtConcurrent::blockingMap(chunks, function);
+    else if (chunks.size() == 1)
+        function(chunks[0]);
+}
+
+// Smooth normals for meshes that come without them, like Assimp's GenSmoothNormals:
+// every corner averages the area weighted normals of the triangles around its
+// position that are within maxAngle of its own one. Vertices whose corners end up
+// with different normals are split. `positionIds` groups the vertices by position,
+// if it's empty every vertex is a position of its own.
+static void generateNormals(QVector<Vertex>& vertices, QVector<uint32_t>& indices,
+                            const QVector<int>& positionIds, int positionCount, float maxAngle) {
+    int triangleCount = indices.size() / 3;
+    int cornerCount = triangleCount * 3;
+    const int* ids = positionIds.size() ? positionIds.constData() : 0;
+
+    // Twice the area long
+    QVector<QVector3D> faceNormals(triangleCount);
+    for (int t = 0; t < triangleCount; t++) {
+        const QVector3D& p0 = vertices[indices[t * 3 + 0]].position;
+        const QVector3D& p1 = vertices[indices[t * 3 + 1]].position;
+        const QVector3D& p2 = vertices[indices[t * 3 + 2]].position;
+        faceNormals[t] = QVector3D::crossProduct(p1 - p0, p2 - p0);
+    }
+
+    QVector<QVector3D> cornerNormals(cornerCount);
+    if (maxAngle >= smoothAllAngle) {
+        QVector<QVector3D> sums(positionCount);
+        for (int c = 0; c < cornerCount; c++)
+            sums[ids ? ids[indices[c]] : int(indices[c])] += faceNormals[c / 3];
+        for (int c = 0; c < cornerCount; c++)
+            cornerNormals[c] = sums[ids ? ids[indices[c]] : int(indices[c])].normalized();
+    } else {
+        // Triangles around each position
+        QVector<int> offsets(positionCount + 1, 0), faces(cornerCount);
+        for (int c = 0; c < cornerCount; c++)
+            offsets[(ids ? ids[indices[c]] : int(indices[c])) + 1]++;
+        for (int i = 0; i < positionCount; i++)
+            offsets[i + 1] += offsets[i];
+        QVector<int> fill = offsets;
+        for (int c = 0; c < cornerCount; c++)
+            faces[fill[ids ? ids[indices[c]] : int(indices[c])]++] = c / 3;
+
+        QVector<QVector3D> units(triangleCount);
+        for (int t = 0; t < triangleCount; t++)
+            units[t] = faceNormals[t].normalized();
+        float minCos = cosf(maxAngle * pi / 180.0f);
+        for (int c = 0; c < cornerCount; c++) {
+            int id = ids ? ids[indices[c]] : int(indices[c]);
+            const QVector3D& unit = units[c / 3];
+            QVector3D sum;
+            for (int i = offsets[id]; i < offsets[id + 1]; i++)
+                if (QVector3D::dotProduct(units[faces[i]], unit) >= minCos)
+                    sum += faceNormals[faces[i]];
+            cornerNormals[c] = sum.normalized();
+        }
+    }
+
+    QVector<bool> assigned(vertices.size(), false);
+    QVector<int> nextCopy(vertices.size(), -1);
+    for (int c = 0; c < cornerCount; c++) {
+        int v = int(indices[c]);
+        QVector3D normal = cornerNormals[c].isNull() ? QVector3D(0, 0, 1) : cornerNormals[c];
+        if (!assigned[v]) {
+            vertices[v].normal = normal;
+            assigned[v] = true;
+            continue;
+        }
+        int u = v, last = v;
+        while (u >= 0 && QVector3D::dotProduct(vertices[u].normal, normal) < 0.9999f) {
+            last = u;
+            u = nextCopy[u];
+        }
+        if (u < 0) {
+            Vertex copy = vertices[v];
+            copy.normal = normal;
+            u = vertices.size();
+            vertices.push_back(copy);
+            assigned.push_back(true);
+            nextCopy.push_back(-1);
+            nextCopy[last] = u;
+        }
+        indices[c] = uint32_t(u);
+    }
+}
+
+// Tangents along u and bitangents against v, accumulated over the triangles, with the
+// same conventions as the ones Assimp computes
+static void generateTangents(QVector<Vertex>& vertices, const QVector<uint32_t>& indices) {
+    for (int i = 0; i < vertices.size(); i++)
+        vertices[i].tangent = vertices[i].bitangent = QVector3D(0, 0, 0);
+
+    for (int i = 0; i + 2 < indices.size(); i += 3) {
+        Vertex& v0 = vertices[indices[i + 0]];
+        Vertex& v1 = vertices[indices[i + 1]];
+        Vertex& v2 = vertices[indices[i + 2]];
+        QVector3D e1 = v1.position - v0.position, e2 = v2.position - v0.position;
+        QVector2D d1 = v1.texCoords - v0.texCoords, d2 = v2.texCoords - v0.texCoords;
+        float r = d1.x() * d2.y() - d2.x() * d1.y();
+        if (qAbs(r) < FLT_MIN) continue;
+        QVector3D tangent = (e1 * d2.y() - e2 * d1.y()) / r;
+        QVector3D bitangent = (e1 * d2.x() - e2 * d1.x()) / r;
+        v0.tangent += tangent; v1.tangent += tangent; v2.tangent += tangent;
+        v0.bitangent += bitangent; v1.bitangent += bitangent; v2.bitangent += bitangent;
+    }
+
+    for (int i = 0; i < vertices.size(); i++) {
+        Vertex& vertex = vertices[i];
+        if (QVector3D::crossProduct(vertex.tangent, vertex.normal).lengthSquared() < FLT_MIN) {
+            // No texture gradient, any frame around the normal does
+            const QVector3D& n = vertex.normal;
+            vertex.tangent = QVector3D::crossProduct(qAbs(n.y()) < 0.99f ? QVector3D(0, 1, 0) : QVector3D(1, 0, 0), n);
+            vertex.bitangent = QVector3D::crossProduct(vertex.tangent, n);
+        }
+        vertex.bitangent.normalize();
+    }
+    orthogonalizeTangents(vertices.data(), vertices.size());
+}
+
+static inline bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline const char* skipSpaces(const char* p, const char* end) {
+    while (p < end && isSpace(*p)) p++;
+    return p;
+}
+
+static inline const char* nextLine(const char* p, const char* end) {
+    const char* q = static_cast<const char*>(memchr(p, '\n', size_t(end - p)));
+    return q ? q + 1 : end;
+}
+
+static inline const char* lineEnd(const char* p, const char* end) {
+    const char* q = static_cast<const char*>(memchr(p, '\n', size_t(end - p)));
+    return q ? q : end;
+}
+
+static inline bool isDigit(char c) {
+    return unsigned(c - '0') < 10;
+}
+
+// Locale independent and much faster than strtof, rounds differently from it by at
+// most one bit of the float
+static bool parseFloat(const char*& p, const char* end, float& value) {
+    static const double powers[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    const char* q = skipSpaces(p, end);
+    bool negative = false;
+    if (q < end && (*q == '-' || *q == '+'))
+        negative = *q++ == '-';
+
+    double mantissa = 0.0;
+    int exponent = 0;
+    bool digits = false;
+    while (q < end && isDigit(*q)) {
+        mantissa = mantissa * 10.0 + (*q++ - '0');
+        digits = true;
+    }
+    if (q < end && *q == '.') {
+        q++;
+        while (q < end && isDigit(*q)) {
+            mantissa = mantissa * 10.0 + (*q++ - '0');
+            exponent--;
+            digits = true;
+        }
+    }
+    if (!digits) return false;
+
+    if (q < end && (*q == 'e' || *q == 'E')) {
+        const char* e = q + 1;
+        bool negativeExponent = false;
+        if (e < end && (*e == '-' || *e == '+'))
+            negativeExponent = *e++ == '-';
+        if (e < end && isDigit(*e)) {
+            int n = 0;
+            while (e < end && isDigit(*e))
+                n = qMin(n * 10 + (*e++ - '0'), 1000);
+            exponent += negativeExponent ? -n : n;
+            q = e;
+        }
+    }
+
+    if (exponent < 0)
+        mantissa = exponent >= -22 ? mantissa / powers[-exponent] : mantissa * pow(10.0, exponent);
+    else if (exponent > 0)
+        mantissa = exponent <= 22 ? mantissa * powers[exponent] : mantissa * pow(10.0, exponent);
+    value = float(negative ? -mantissa : mantissa);
+    p = q;
+    return true;
+}
+
+static bool parseInt(const char*& p, const char* end, int& value) {
+    const char* q = p;
+    bool negative = false;
+    if (q < end && (*q == '-' || *q == '+'))
+        negative = *q++ == '-';
+    if (q == end || !isDigit(*q)) return false;
+    qint64 n = 0;
+    while (q < end && isDigit(*q))
+        n = qMin(n * 10 + (*q++ - '0'), qint64(INT_MAX));
+    value = int(negative ? -n : n);
+    p = q;
+    return true;
+}
+
+// Chunks of text ending at line ends
+static QVector<QPair<const char*, const char*>> splitLines(const char* begin, const char* end) {
+    QVector<QPair<const char*, const char*>> chunks;
+    while (begin < end) {
+        const char* split = end - begin > textChunkSize ? nextLine(begin + textChunkSize, end) : end;
+        chunks.push_back(qMakePair(begin, split));
+        begin = split;
+    }
+    return chunks;
+}
+
+NativeModelReader::MaterialInfo::MaterialInfo() {
+    name = "DefaultMaterial";
+    ambient = QVector3D(0, 0, 0);
+    diffuse = QVector3D(0.6f, 0.6f, 0.6f);
+    specular = QVector3D(0, 0, 0);
+    shininess = 0.0f;
+}
+
+NativeModelReader::NativeModelReader() {
+    m_ignoreTexCoords = false;
+    m_tangentMode = AllTangents;
+    m_maxSmoothingAngle = smoothAllAngle;
+    m_future = 0;
+}
+
+bool NativeModelReader::canRead(QString filePath) {
+    QString suffix = QFileInfo(filePath).suffix().toLower();
+    if (suffix == "obj")
+        return true;
+    if (suffix != "ply" && suffix != "stl")
+        return false;
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    if (suffix == "stl") {
+        // Text files can start with anything, only the size tells the binary ones apart
+        QByteArray header = file.read(84);
+        quint32 triangleCount;
+        if (header.size() < 84) return false;
+        memcpy(&triangleCount, header.constData() + 80, 4);
+        return file.size() == 84 + qint64(triangleCount) * 50;
+    }
+    QByteArray header = file.read(512);
+    return header.startsWith("ply") &&
+           (header.contains("format binary_little_endian") || header.contains("format binary_big_endian"));
+}
+
+bool NativeModelReader::ignoreTexCoords() const {
+    return m_ignoreTexCoords;
+}
+
+void NativeModelReader::setIgnoreTexCoords(bool ignore) {
+    m_ignoreTexCoords = ignore;
+}
+
+NativeModelReader::TangentMode NativeModelReader::tangentMode() const {
+    return m_tangentMode;
+}
+
+void NativeModelReader::setTangentMode(TangentMode mode) {
+    m_tangentMode = mode;
+}
+
+float NativeModelReader::maxSmoothingAngle() const {
+    return m_maxSmoothingAngle;
+}
+
+void NativeModelReader::setMaxSmoothingAngle(float degrees) {
+    m_maxSmoothingAngle = degrees;
+}
+
+void NativeModelReader::setFuture(const QFutureInterfaceBase * future) {
+    m_future = future;
+}
+
+bool NativeModelReader::read(QString filePath) {
+    m_error.clear();
+    m_meshes.clear();
+    m_materials.clear();
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        m_error = file.errorString();
+        return false;
+    }
+    qint64 size = file.size();
+    if (size == 0) {
+        m_error = "File is empty";
+        return false;
+    }
+    QByteArray buffer;
+    const char* data = reinterpret_cast<const char*>(file.map(0, size));
+    if (!data) {
+        buffer = file.readAll();
+        data = buffer.constData();
+        size = buffer.size();
+    }
+
+    QString suffix = QFileInfo(filePath).suffix().toLower();
+    bool ok;
+    if (suffix == "obj")
+        ok = readObj(filePath, data, size);
+    else if (suffix == "ply")
+        ok = readPly(filePath, data, size);
+    else if (suffix == "stl")
+        ok = readStl(filePath, data, size);
+    else {
+        m_error = "Unsupported format";
+        ok = false;
+    }
+
+    if (ok && isCanceled()) {
+        m_error = "Canceled";
+        ok = false;
+    }
+    if (!ok) {
+        m_meshes.clear();
+        m_materials.clear();
+    }
+    return ok;
+}
+
+QString NativeModelReader::errorString() const {
+    return m_error;
+}
+
+QVector<NativeModelReader::MeshData>& NativeModelReader::meshes() {
+    return m_meshes;
+}
+
+const QVector<NativeModelReader::MaterialInfo>& NativeModelReader::materials() const {
+    return m_materials;
+}
+
+bool NativeModelReader::isCanceled() const {
+    return m_future && m_future->isCanceled();
+}
+
+// OBJ files are read in two passes over the chunks, the first one counts the
+// attributes so that the second one can parse them straight into the arrays of the
+// whole file and resolve relative indices. Faces are triangulated into corners.
+
+struct ObjCorner {
+    int position, texCoord, normal; // -1 if left out
+};
+
+// An o, g or usemtl statement, which starts a new mesh
+struct ObjStatement {
+    int corner;
+    bool isMaterial;
+    QByteArray value;
+};
+
+struct ObjChunk {
+    const char* begin;
+    const char* end;
+    int positionCount, texCoordCount, normalCount;
+    int positionBase, texCoordBase, normalBase; // of the whole file
+    QVector3D* positions;
+    QVector2D* texCoords; // null if they are ignored
+    QVector3D* normals;
+    QVector<ObjCorner> corners;
+    QVector<ObjStatement> statements;
+    QList<QByteArray> materialLibraries;
+    const QFutureInterfaceBase* future;
+    QByteArray error;
+};
+
+static inline bool isKeyword(const char* p, const char* end, const char* keyword, int length) {
+    return end - p > length && memcmp(p, keyword, size_t(length)) == 0 && isSpace(p[length]);
+}
+
+static void countObjChunk(ObjChunk& chunk) {
+    chunk.positionCount = chunk.texCoordCount = chunk.normalCount = 0;
+    if (chunk.future && chunk.future->isCanceled()) return;
+    for (const char* p = chunk.begin; p < chunk.end; p = nextLine(p, chunk.end)) {
+        const char* end = lineEnd(p, chunk.end);
+        p = skipSpaces(p, end);
+        if (isKeyword(p, end, "v", 1)) chunk.positionCount++;
+        else if (isKeyword(p, end, "vt", 2)) chunk.texCoordCount++;
+        else if (isKeyword(p, end, "vn", 2)) chunk.normalCount++;
+    }
+}
+
+// 1-based indices, negative ones counting back from the last attribute so far
+static inline bool resolveObjIndex(int index, int count, int& result) {
+    if (index > 0) result = index - 1;
+    else if (index < 0) result = count + index;
+    else return false;
+    return result >= 0;
+}
+
+static bool parseObjCorner(const char*& p, const char* end, const ObjChunk& chunk,
+                           int positions, int texCoords, int normals, ObjCorner& corner) {
+    int index;
+    corner.texCoord = corner.normal = -1;
+    if (!parseInt(p, end, index) || !resolveObjIndex(index, positions, corner.position))
+        return false;
+    if (p < end && *p == '/') {
+        p++;
+        if (p < end && *p != '/') {
+            if (!parseInt(p, end, index) || !resolveObjIndex(index, texCoords, corner.texCoord))
+                return false;
+            if (!chunk.texCoords) corner.texCoord = -1;
+        }
+        if (p < end && *p == '/') {
+            p++;
+            if (!parseInt(p, end, index) || !resolveObjIndex(index, normals, corner.normal))
+                return false;
+        }
+    }
+    return true;
+}
+
+static void parseObjChunk(ObjChunk& chunk) {
+    if (chunk.future && chunk.future->isCanceled()) return;
+    int positions = chunk.positionBase, texCoords = chunk.texCoordBase, normals = chunk.normalBase;
+    QVector<ObjCorner> polygon;
+
+    for (const char* line = chunk.begin; line < chunk.end && chunk.error.isEmpty(); line = nextLine(line, chunk.end)) {
+        const char* end = lineEnd(line, chunk.end);
+        const char* p = skipSpaces(line, end);
+        if (p == end || *p == '#') continue;
+
+        if (isKeyword(p, end, "v", 1)) {
+            float* f = reinterpret_cast<float*>(&chunk.positions[positions++]);
+            p++;
+            if (!parseFloat(p, end, f[0]) || !parseFloat(p, end, f[1]) || !parseFloat(p, end, f[2]))
+                chunk.error = "Invalid vertex position";
+        } else if (isKeyword(p, end, "vt", 2)) {
+            if (chunk.texCoords) {
+                float* f = reinterpret_cast<float*>(&chunk.texCoords[texCoords]);
+                p += 2;
+                if (!parseFloat(p, end, f[0]))
+                    chunk.error = "Invalid texture coordinates";
+                else if (!parseFloat(p, end, f[1]))
+                    f[1] = 0.0f;
+            }
+            texCoords++;
+        } else if (isKeyword(p, end, "vn", 2)) {
+            float* f = reinterpret_cast<float*>(&chunk.normals[normals++]);
+            p += 2;
+            if (!parseFloat(p, end, f[0]) || !parseFloat(p, end, f[1]) || !parseFloat(p, end, f[2]))
+                chunk.error = "Invalid vertex normal";
+        } else if (isKeyword(p, end, "f", 1)) {
+            polygon.clear();
+            ObjCorner corner;
+            for (p = skipSpaces(p + 1, end); p < end; p = skipSpaces(p, end)) {
+                if (!parseObjCorner(p, end, chunk, positions, texCoords, normals, corner)) {
+                    chunk.error = "Invalid face";
+                    break;
+                }
+                polygon.push_back(corner);
+            }
+            if (chunk.error.isEmpty() && polygon.size() < 3)
+                chunk.error = "Faces with less than three vertices aren't supported";
+            for (int i = 2; i < polygon.size() && chunk.error.isEmpty(); i++) {
+                chunk.corners.push_back(polygon[0]);
+                chunk.corners.push_back(polygon[i - 1]);
+                chunk.corners.push_back(polygon[i]);
+            }
+        } else if (isKeyword(p, end, "o", 1) || isKeyword(p, end, "g", 1)) {
+            ObjStatement statement = { chunk.corners.size(), false, QByteArray(p + 1, int(end - p - 1)).trimmed() };
+            chunk.statements.push_back(statement);
+        } else if (isKeyword(p, end, "usemtl", 6)) {
+            ObjStatement statement = { chunk.corners.size(), true, QByteArray(p + 6, int(end - p - 6)).trimmed() };
+            chunk.statements.push_back(statement);
+        } else if (isKeyword(p, end, "mtllib", 6)) {
+            chunk.materialLibraries.push_back(QByteArray(p + 6, int(end - p - 6)).trimmed());
+        } else if (isKeyword(p, end, "l", 1) || isKeyword(p, end, "p", 1)) {
+            chunk.error = "Lines and points aren't supported";
+        }
+    }
+}
+
+// Corners of one mesh, which may be spread over several chunks
+struct ObjMeshJob {
+    QVector<QPair<const ObjChunk*, QPair<int, int>>> ranges;
+    const QVector3D* positions;
+    const QVector2D* texCoords;
+    const QVector3D* normals;
+    int positionCount, texCoordCount, normalCount;
+    bool tangents;
+    float maxSmoothingAngle;
+    const QFutureInterfaceBase* future;
+    NativeModelReader::MeshData* mesh;
+    QByteArray error;
+};
+
+// Corners with the same attribute indices become one vertex. The vertices made for
+// a position are chained, so no hashing is needed.
+static void buildObjMesh(ObjMeshJob& job) {
+    if (job.future && job.future->isCanceled()) return;
+
+    int cornerCount = 0, minPosition = INT_MAX, maxPosition = -1;
+    bool hasTexCoords = false, missingNormals = false;
+    for (int r = 0; r < job.ranges.size(); r++) {
+        const ObjCorner* corners = job.ranges[r].first->corners.constData();
+        for (int c = job.ranges[r].second.first; c < job.ranges[r].second.second; c++) {
+            const ObjCorner& corner = corners[c];
+            if (corner.position >= job.positionCount || corner.texCoord >= job.texCoordCount || corner.normal >= job.normalCount) {
+                job.error = "Face refers to a missing vertex attribute";
+                return;
+            }
+            minPosition = qMin(minPosition, corner.position);
+            maxPosition = qMax(maxPosition, corner.position);
+            hasTexCoords |= corner.texCoord >= 0;
+            missingNormals |= corner.normal < 0;
+        }
+        cornerCount += job.ranges[r].second.second - job.ranges[r].second.first;
+    }
+
+    if (!fitsInArray(cornerCount, sizeof(uint32_t))) {
+        job.error = "Mesh is too large";
+        return;
+    }
+
+    QVector<Vertex>& vertices = job.mesh->vertices;
+    QVector<uint32_t>& indices = job.mesh->indices;
+    QVector<int> first(maxPosition - minPosition + 1, -1), next, positionIds;
+    QVector<ObjCorner> keys;
+    int maxVertexCount = int((INT_MAX - 1024) / sizeof(Vertex));
+    vertices.reserve(qMin(first.size(), maxVertexCount));
+    indices.reserve(cornerCount);
+
+    for (int r = 0; r < job.ranges.size(); r++) {
+        const ObjCorner* corners = job.ranges[r].first->corners.constData();
+        for (int c = job.ranges[r].second.first; c < job.ranges[r].second.second; c++) {
+            const ObjCorner& corner = corners[c];
+            int id = corner.position - minPosition;
+            int v = first[id];
+            while (v >= 0 && (keys[v].texCoord != corner.texCoord || keys[v].normal != corner.normal))
+                v = next[v];
+            if (v < 0) {
+                v = vertices.size();
+                if (v == maxVertexCount) {
+                    job.error = "Mesh is too large";
+                    return;
+                }
+                Vertex vertex;
+                vertex.position = job.positions[corner.position];
+                if (corner.normal >= 0) vertex.normal = job.normals[corner.normal];
+                if (corner.texCoord >= 0) vertex.texCoords = job.texCoords[corner.texCoord];
+                vertices.push_back(vertex);
+                keys.push_back(corner);
+                positionIds.push_back(id);
+                next.push_back(first[id]);
+                first[id] = v;
+            }
+            indices.push_back(uint32_t(v));
+        }
+    }
+    vertices.squeeze();
+
+    if (missingNormals)
+        generateNormals(vertices, indices, positionIds, first.size(), job.maxSmoothingAngle);
+    if (job.tangents && hasTexCoords)
+        generateTangents(vertices, indices);
+}
+
+// Cuts the faces of a job into parts of at most maxPartTriangles, in file order.
+// Normals generated for such meshes may show seams where the parts meet.
+static void splitObjJob(const ObjMeshJob& job, const NativeModelReader::MeshData& mesh,
+                        QVector<ObjMeshJob>& jobs, QVector<NativeModelReader::MeshData>& meshes) {
+    const qint64 partCorners = qint64(maxPartTriangles) * 3;
+    qint64 cornerCount = 0;
+    for (int r = 0; r < job.ranges.size(); r++)
+        cornerCount += job.ranges[r].second.second - job.ranges[r].second.first;
+    if (cornerCount <= partCorners) {
+        jobs.push_back(job);
+        meshes.push_back(mesh);
+        return;
+    }
+
+    ObjMeshJob part = job;
+    part.ranges.clear();
+    qint64 corners = 0;
+    int partNumber = 0;
+    for (int r = 0; r < job.ranges.size(); r++) {
+        // Ranges hold whole triangles and parts a multiple of 3 corners, so no
+        // triangle is cut
+        int begin = job.ranges[r].second.first, end = job.ranges[r].second.second;
+        while (begin < end) {
+            int count = int(qMin(qint64(end - begin), partCorners - corners));
+            part.ranges.push_back(qMakePair(job.ranges[r].first, qMakePair(begin, begin + count)));
+            begin += count;
+            corners += count;
+            if (corners == partCorners || (begin == end && r + 1 == job.ranges.size())) {
+                jobs.push_back(part);
+                meshes.push_back(mesh);
+                meshes.back().name += QString(" %1").arg(++partNumber);
+                part.ranges.clear();
+                corners = 0;
+            }
+        }
+    }
+}
+
+bool NativeModelReader::readObj(QString filePath, const char * data, qint64 size) {
+    QVector<QPair<const char*, const char*>> ranges = splitLines(data, data + size);
+    QVector<ObjChunk> chunks(ranges.size());
+    for (int i = 0; i < chunks.size(); i++) {
+        chunks[i].begin = ranges[i].first;
+        chunks[i].end = ranges[i].second;
+        chunks[i].future = m_future;
+    }
+    runChunks(chunks, countObjChunk);
+
+    qint64 positionCount = 0, texCoordCount = 0, normalCount = 0;
+    for (int i = 0; i < chunks.size(); i++) {
+        chunks[i].positionBase = int(positionCount);
+        chunks[i].texCoordBase = int(texCoordCount);
+        chunks[i].normalBase = int(normalCount);
+        positionCount += chunks[i].positionCount;
+        texCoordCount += chunks[i].texCoordCount;
+        normalCount += chunks[i].normalCount;
+    }
+    if (!fitsInArray(qMax(positionCount, normalCount), sizeof(QVector3D)) || !fitsInArray(texCoordCount, sizeof(QVector2D))) {
+        m_error = QString("Files with more than %1 positions or normals or %2 texture coordinates aren't supported")
+            .arg(int((INT_MAX - 1024) / sizeof(QVector3D))).arg(int((INT_MAX - 1024) / sizeof(QVector2D)));
+        return false;
+    }
+
+    QVector<QVector3D> positions(static_cast<int>(positionCount)), normals(static_cast<int>(normalCount));
+    QVector<QVector2D> texCoords(m_ignoreTexCoords ? 0 : int(texCoordCount));
+    for (int i = 0; i < chunks.size(); i++) {
+        chunks[i].positions = positions.data();
+        chunks[i].texCoords = m_ignoreTexCoords ? 0 : texCoords.data();
+        chunks[i].normals = normals.data();
+    }
+    runChunks(chunks, parseObjChunk);
+    if (isCanceled()) return false;
+    for (int i = 0; i < chunks.size(); i++)
+        if (!chunks[i].error.isEmpty()) {
+            m_error = chunks[i].error;
+            return false;
+        }
+
+    QHash<QByteArray, int> materialIndices;
+    for (int i = 0; i < chunks.size(); i++)
+        for (int j = 0; j < chunks[i].materialLibraries.size(); j++)
+            readMaterialLibrary(QFileInfo(filePath).dir().filePath(chunks[i].materialLibraries[j]), materialIndices);
+
+    // One mesh per object or group and material, the statements only hold for the
+    // chunks after their own one too
+    QVector<ObjMeshJob> jobs;
+    QHash<QPair<QByteArray, QByteArray>, int> meshIndices;
+    QByteArray name, material;
+    int current = -1;
+    for (int i = 0; i < chunks.size(); i++) {
+        const ObjChunk& chunk = chunks[i];
+        for (int s = 0; s <= chunk.statements.size(); s++) {
+            int begin = s == 0 ? 0 : chunk.statements[s - 1].corner;
+            int end = s < chunk.statements.size() ? chunk.statements[s].corner : chunk.corners.size();
+            if (s > 0) {
+                const ObjStatement& statement = chunk.statements[s - 1];
+                (statement.isMaterial ? material : name) = statement.value;
+                current = -1;
+            }
+            if (begin == end) continue;
+            if (current < 0) {
+                QPair<QByteArray, QByteArray> key(name, material);
+                current = meshIndices.value(key, -1);
+                if (current < 0) {
+                    current = jobs.size();
+                    meshIndices[key] = current;
+                    ObjMeshJob job;
+                    job.positions = positions.constData();
+                    job.texCoords = texCoords.constData();
+                    job.normals = normals.constData();
+                    job.positionCount = positions.size();
+                    job.texCoordCount = m_ignoreTexCoords ? INT_MAX : texCoords.size();
+                    job.normalCount = normals.size();
+                    job.maxSmoothingAngle = m_maxSmoothingAngle;
+                    job.future = m_future;
+                    job.mesh = 0;
+                    jobs.push_back(job);
+
+                    MeshData mesh;
+                    mesh.name = name.isEmpty() ? QFileInfo(filePath).baseName() : QString::fromUtf8(name);
+                    mesh.material = materialIndices.value(material, -1);
+                    mesh.tangents = m_tangentMode == AllTangents ||
+                        (m_tangentMode == BumpMappedTangents && mesh.material >= 0 &&
+                         !m_materials[mesh.material].bumpTexture.isEmpty());
+                    m_meshes.push_back(mesh);
+                }
+            }
+            jobs[current].ranges.push_back(qMakePair(&chunk, qMakePair(begin, end)));
+        }
+    }
+
+    QVector<ObjMeshJob> partJobs;
+    QVector<MeshData> partMeshes;
+    for (int i = 0; i < jobs.size(); i++)
+        splitObjJob(jobs[i], m_meshes[i], partJobs, partMeshes);
+    jobs = partJobs;
+    m_meshes = partMeshes;
+
+    for (int i = 0; i < jobs.size(); i++) {
+        jobs[i].mesh = &m_meshes[i];
+        jobs[i].tangents = m_meshes[i].tangents;
+    }
+    runChunks(jobs, buildObjMesh);
+    for (int i = 0; i < jobs.size(); i++)
+        if (!jobs[i].error.isEmpty()) {
+            m_error = jobs[i].error;
+            return false;
+        }
+    return true;
+}
+
+void NativeModelReader::readMaterialLibrary(QString filePath, QHash<QByteArray, int>& materialIndices) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        if (log_level >= LOG_LEVEL_WARNING)
+            dout << "Failed to open material library" << filePath;
+        return;
+    }
+
+    MaterialInfo* material = 0;
+    while (!file.atEnd()) {
+        QList<QByteArray> tokens = file.readLine().simplified().split(' ');
+        QByteArray keyword = tokens[0].toLower();
+        if (keyword == "newmtl" && tokens.size() > 1) {
+            QByteArray name = tokens.mid(1).join(' ');
+            materialIndices[name] = m_materials.size();
+            m_materials.push_back(MaterialInfo());
+            material = &m_materials.back();
+            material->name = QString::fromUtf8(name);
+        } else if (!material || tokens.size() < 2) {
+            continue;
+        } else if ((keyword == "ka" || keyword == "kd" || keyword == "ks") && tokens.size() > 3) {
+            QVector3D color(tokens[1].toFloat(), tokens[2].toFloat(), tokens[3].toFloat());
+            (keyword == "ka" ? material->ambient : keyword == "kd" ? material->diffuse : material->specular) = color;
+        } else if (keyword == "ns") {
+            material->shininess = tokens[1].toFloat();
+        } else if (keyword == "map_kd") {
+            material->diffuseTexture = QString::fromUtf8(tokens.back()); // options come first
+        } else if (keyword == "map_ks") {
+            material->specularTexture = QString::fromUtf8(tokens.back());
+        } else if (keyword == "map_bump" || keyword == "bump") {
+            material->bumpTexture = QString::fromUtf8(tokens.back());
+        }
+    }
+}
+
+// Binary PLY files. Elements of fixed size records are decoded in chunks right
+// away, faces are lists and are scanned once to find where the chunks start.
+
+enum PlyType {
+    PlyInvalid, PlyInt8, PlyUInt8, PlyInt16, PlyUInt16, PlyInt32, PlyUInt32, PlyFloat32, PlyFloat64
+};
+
+struct PlyProperty {
+    QByteArray name;
+    PlyType type;
+    PlyType countType; // PlyInvalid unless it's a list
+    int offset; // in a fixed size record
+};
+
+struct PlyElement {
+    QByteArray name;
+    qint64 count;
+    QVector<PlyProperty> properties;
+    int size; // of a record, 0 if it has lists
+};
+
+static PlyType plyType(const QByteArray& name) {
+    if (name == "char" || name == "int8") return PlyInt8;
+    if (name == "uchar" || name == "uint8") return PlyUInt8;
+    if (name == "short" || name == "int16") return PlyInt16;
+    if (name == "ushort" || name == "uint16") return PlyUInt16;
+    if (name == "int" || name == "int32") return PlyInt32;
+    if (name == "uint" || name == "uint32") return PlyUInt32;
+    if (name == "float" || name == "float32") return PlyFloat32;
+    if (name == "double" || name == "float64") return PlyFloat64;
+    return PlyInvalid;
+}
+
+static int plyTypeSize(PlyType type) {
+    static const int sizes[] = { 0, 1, 1, 2, 2, 4, 4, 4, 8 };
+    return sizes[type];
+}
+
+template <typename T>
+static inline T readRaw(const uchar* p, bool swap) {
+    T value;
+    if (!swap)
+        memcpy(&value, p, sizeof(T));
+    else {
+        uchar bytes[sizeof(T)];
+        for (size_t i = 0; i < sizeof(T); i++)
+            bytes[i] = p[sizeof(T) - 1 - i];
+        memcpy(&value, bytes, sizeof(T));
+    }
+    return value;
+}
+
+static inline double readPlyValue(const uchar* p, PlyType type, bool swap) {
+    switch (type) {
+    case PlyInt8: return *reinterpret_cast<const qint8*>(p);
+    case PlyUInt8: return *p;
+    case PlyInt16: return readRaw<qint16>(p, swap);
+    case PlyUInt16: return readRaw<quint16>(p, swap);
+    case PlyInt32: return readRaw<qint32>(p, swap);
+    case PlyUInt32: return readRaw<quint32>(p, swap);
+    case PlyFloat32: return readRaw<float>(p, swap);
+    case PlyFloat64: return readRaw<double>(p, swap);
+    default: return 0.0;
+    }
+}
+
+static inline quint32 readPlyIndex(const uchar* p, PlyType type, bool swap) {
+    switch (type) {
+    case PlyInt8: case PlyUInt8: return *p;
+    case PlyInt16: case PlyUInt16: return readRaw<quint16>(p, swap);
+    default: return readRaw<quint32>(p, swap);
+    }
+}
+
+// Past the record at p, 0 if it runs over the end
+static const uchar* skipPlyRecord(const PlyElement& element, const uchar* p, const uchar* end, bool swap) {
+    if (element.size)
+        return end - p >= element.size ? p + element.size : 0;
+    for (int i = 0; i < element.properties.size(); i++) {
+        const PlyProperty& property = element.properties[i];
+        if (property.countType == PlyInvalid)
+            p += plyTypeSize(property.type);
+        else {
+            int countSize = plyTypeSize(property.countType);
+            if (end - p < countSize) return 0;
+            qint64 count = qint64(readPlyValue(p, property.countType, swap));
+            p += countSize + qMax(count, qint64(0)) * plyTypeSize(property.type);
+        }
+        if (p > end) return 0;
+    }
+    return p;
+}
+
+static int plyPropertyIndex(const PlyElement& element, const char* name, const char* alternative = 0) {
+    for (int i = 0; i < element.properties.size(); i++)
+        if (element.properties[i].name == name || (alternative && element.properties[i].name == alternative))
+            return i;
+    return -1;
+}
+
+struct PlyVertexChunk {
+    const uchar* data;
+    qint64 first, count;
+    const PlyElement* element;
+    int position[3], normal[3], texCoord[2]; // property indices, -1 if missing
+    bool swap;
+    Vertex* vertices;
+    const QFutureInterfaceBase* future;
+};
+
+static void decodePlyVertices(PlyVertexChunk& chunk) {
+    if (chunk.future && chunk.future->isCanceled()) return;
+    const QVector<PlyProperty>& properties = chunk.element->properties;
+    for (qint64 i = chunk.first; i < chunk.first + chunk.count; i++) {
+        const uchar* record = chunk.data + i * chunk.element->size;
+        Vertex& vertex = chunk.vertices[i];
+        for (int k = 0; k < 3; k++) {
+            const PlyProperty& position = properties[chunk.position[k]];
+            vertex.position[k] = float(readPlyValue(record + position.offset, position.type, chunk.swap));
+            if (chunk.normal[k] >= 0) {
+                const PlyProperty& normal = properties[chunk.normal[k]];
+                vertex.normal[k] = float(readPlyValue(record + normal.offset, normal.type, chunk.swap));
+            }
+        }
+        for (int k = 0; k < 2 && chunk.texCoord[k] >= 0; k++) {
+            const PlyProperty& texCoord = properties[chunk.texCoord[k]];
+            vertex.texCoords[k] = float(readPlyValue(record + texCoord.offset, texCoord.type, chunk.swap));
+        }
+    }
+}
+
+struct PlyFaceChunk {
+    const uchar* data;
+    qint64 count; // faces
+    qint64 firstIndex;
+    const PlyElement* element;
+    int list; // property index of the vertex indices
+    quint32 vertexCount;
+    bool swap;
+    uint32_t* indices;
+    const QFutureInterfaceBase* future;
+    bool invalid;
+};
+
+static void decodePlyFaces(PlyFaceChunk& chunk) {
+    chunk.invalid = false;
+    if (chunk.future && chunk.future->isCanceled()) return;
+    const QVector<PlyProperty>& properties = chunk.element->properties;
+    const PlyProperty& list = properties[chunk.list];
+    int indexSize = plyTypeSize(list.type);
+    uint32_t* out = chunk.indices + chunk.firstIndex;
+    const uchar* p = chunk.data;
+
+    for (qint64 f = 0; f < chunk.count; f++) {
+        for (int i = 0; i < properties.size(); i++) {
+            const PlyProperty& property = properties[i];
+            if (property.countType == PlyInvalid) {
+                p += plyTypeSize(property.type);
+                continue;
+            }
+            int count = int(readPlyValue(p, property.countType, chunk.swap));
+            p += plyTypeSize(property.countType);
+            if (i == chunk.list) {
+                uint32_t i0 = readPlyIndex(p, list.type, chunk.swap), previous = 0;
+                for (int k = 1; k < count; k++) {
+                    uint32_t index = readPlyIndex(p + k * indexSize, list.type, chunk.swap);
+                    if (k >= 2) {
+                        *out++ = i0;
+                        *out++ = previous;
+                        *out++ = index;
+                    }
+                    previous = index;
+                    chunk.invalid |= index >= chunk.vertexCount;
+                }
+                chunk.invalid |= count > 0 && i0 >= chunk.vertexCount;
+            }
+            p += qMax(count, 0) * plyTypeSize(property.type);
+        }
+    }
+}
+
+bool NativeModelReader::readPly(QString filePath, const char * data, qint64 size) {
+    // Header
+    const char* end = data + size;
+    const char* p = data;
+    QVector<PlyElement> elements;
+    bool bigEndian = false, binary = false, header = false;
+    for (int lineNumber = 0; p < end && !header; lineNumber++) {
+        const char* line = p;
+        p = nextLine(p, end);
+        QList<QByteArray> tokens = QByteArray(line, int(lineEnd(line, end) - line)).simplified().split(' ');
+        if (lineNumber == 0) {
+            if (tokens[0] != "ply") break;
+        } else if (tokens[0] == "format" && tokens.size() > 1) {
+            binary = tokens[1] == "binary_little_endian" || tokens[1] == "binary_big_endian";
+            bigEndian = tokens[1] == "binary_big_endian";
+        } else if (tokens[0] == "element" && tokens.size() > 2) {
+            PlyElement element;
+            element.name = tokens[1];
+            element.count = tokens[2].toLongLong();
+            element.size = 0;
+            elements.push_back(element);
+        } else if (tokens[0] == "property" && tokens.size() > 2 && elements.size()) {
+            PlyProperty property;
+            if (tokens[1] == "list" && tokens.size() > 4) {
+                property.countType = plyType(tokens[2]);
+                property.type = plyType(tokens[3]);
+                property.name = tokens[4];
+                if (property.countType == PlyInvalid) property.type = PlyInvalid;
+            } else {
+                property.countType = PlyInvalid;
+                property.type = plyType(tokens[1]);
+                property.name = tokens[2];
+            }
+            if (property.type == PlyInvalid) {
+                m_error = "Unknown property type";
+                return false;
+            }
+            elements.back().properties.push_back(property);
+        } else if (tokens[0] == "end_header") {
+            header = true;
+        }
+    }
+    if (!header || !binary) {
+        m_error = binary ? "Invalid header" : "Only binary files are supported";
+        return false;
+    }
+
+    for (int i = 0; i < elements.size(); i++) {
+        PlyElement& element = elements[i];
+        int offset = 0;
+        for (int j = 0; j < element.properties.size() && offset >= 0; j++) {
+            element.properties[j].offset = offset;
+            offset = element.properties[j].countType == PlyInvalid ? offset + plyTypeSize(element.properties[j].type) : -1;
+        }
+        element.size = qMax(offset, 0);
+    }
+
+    bool swap = bigEndian != (Q_BYTE_ORDER == Q_BIG_ENDIAN);
+    const uchar* bytes = reinterpret_cast<const uchar*>(p);
+    const uchar* bytesEnd = reinterpret_cast<const uchar*>(end);
+    const PlyElement* vertexElement = 0;
+    const uchar* vertexData = 0;
+    QVector<PlyFaceChunk> faceChunks;
+    qint64 indexCount = 0;
+    int list = -1;
+
+    for (int i = 0; i < elements.size(); i++) {
+        const PlyElement& element = elements[i];
+        if (element.name == "vertex" && !vertexElement) {
+            if (!element.size || element.properties.isEmpty()) {
+                m_error = "Vertices with lists aren't supported";
+                return false;
+            }
+            if ((bytesEnd - bytes) / element.size < element.count) {
+                m_error = "File is truncated";
+                return false;
+            }
+            vertexElement = &element;
+            vertexData = bytes;
+            bytes += element.count * element.size;
+        } else if (element.name == "face" && faceChunks.isEmpty() &&
+                   (list = plyPropertyIndex(element, "vertex_indices", "vertex_index")) >= 0) {
+            // Only the counts are read here, the indices are decoded in parallel
+            int countOffset = 0;
+            for (int j = 0; j < list; j++) {
+                if (element.properties[j].countType != PlyInvalid) {
+                    m_error = "Lists before the vertex indices aren't supported";
+                    return false;
+                }
+                countOffset += plyTypeSize(element.properties[j].type);
+            }
+            if (element.properties[list].countType == PlyInvalid) {
+                m_error = "Faces without a vertex list";
+                return false;
+            }
+            for (qint64 f = 0; f < element.count; f++) {
+                if (f % recordChunkSize == 0) {
+                    PlyFaceChunk chunk;
+                    chunk.data = bytes;
+                    chunk.count = qMin(qint64(recordChunkSize), element.count - f);
+                    chunk.firstIndex = indexCount;
+                    chunk.element = &element;
+                    chunk.list = list;
+                    chunk.swap = swap;
+                    chunk.future = m_future;
+                    faceChunks.push_back(chunk);
+                }
+                const uchar* record = bytes;
+                bytes = skipPlyRecord(element, bytes, bytesEnd, swap);
+                if (!bytes) {
+                    m_error = "File is truncated";
+                    return false;
+                }
+                int count = int(readPlyValue(record + countOffset, element.properties[list].countType, swap));
+                indexCount += qMax(count - 2, 0) * 3;
+            }
+        } else {
+            for (qint64 r = 0; r < element.count; r++)
+                if (!(bytes = skipPlyRecord(element, bytes, bytesEnd, swap))) {
+                    m_error = "File is truncated";
+                    return false;
+                }
+        }
+    }
+    if (!vertexElement || faceChunks.isEmpty()) {
+        m_error = "Point clouds aren't supported";
+        return false;
+    }
+    // Indexed meshes can't be split without remapping their vertices
+    if (!fitsInArray(vertexElement->count, sizeof(Vertex)) || !fitsInArray(indexCount, sizeof(uint32_t))) {
+        m_error = QString("Meshes with more than %1 vertices or %2 triangles aren't supported")
+            .arg(int((INT_MAX - 1024) / sizeof(Vertex))).arg(int((INT_MAX - 1024) / (3 * sizeof(uint32_t))));
+        return false;
+    }
+
+    MeshData mesh;
+    mesh.name = QFileInfo(filePath).baseName();
+    mesh.material = -1;
+    mesh.tangents = m_tangentMode == AllTangents;
+
+    PlyVertexChunk vertexChunk;
+    vertexChunk.data = vertexData;
+    vertexChunk.element = vertexElement;
+    const char* positionNames[] = { "x", "y", "z" };
+    const char* normalNames[] = { "nx", "ny", "nz" };
+    for (int k = 0; k < 3; k++) {
+        vertexChunk.position[k] = plyPropertyIndex(*vertexElement, positionNames[k]);
+        vertexChunk.normal[k] = plyPropertyIndex(*vertexElement, normalNames[k]);
+    }
+    if (vertexChunk.position[0] < 0 || vertexChunk.position[1] < 0 || vertexChunk.position[2] < 0) {
+        m_error = "Vertices without positions";
+        return false;
+    }
+    bool hasNormals = vertexChunk.normal[0] >= 0 && vertexChunk.normal[1] >= 0 && vertexChunk.normal[2] >= 0;
+    if (!hasNormals)
+        vertexChunk.normal[0] = vertexChunk.normal[1] = vertexChunk.normal[2] = -1;
+    vertexChunk.texCoord[0] = plyPropertyIndex(*vertexElement, "u", "s");
+    vertexChunk.texCoord[1] = plyPropertyIndex(*vertexElement, "v", "t");
+    if (vertexChunk.texCoord[0] < 0) {
+        vertexChunk.texCoord[0] = plyPropertyIndex(*vertexElement, "texture_u", "texture_s");
+        vertexChunk.texCoord[1] = plyPropertyIndex(*vertexElement, "texture_v", "texture_t");
+    }
+    bool hasTexCoords = !m_ignoreTexCoords && vertexChunk.texCoord[0] >= 0 && vertexChunk.texCoord[1] >= 0;
+    if (!hasTexCoords)
+        vertexChunk.texCoord[0] = vertexChunk.texCoord[1] = -1;
+    vertexChunk.swap = swap;
+    vertexChunk.future = m_future;
+
+    mesh.vertices.resize(int(vertexElement->count));
+    vertexChunk.vertices = mesh.vertices.data();
+    QVector<PlyVertexChunk> vertexChunks;
+    for (qint64 first = 0; first < vertexElement->count; first += recordChunkSize) {
+        vertexChunk.first = first;
+        vertexChunk.count = qMin(qint64(recordChunkSize), vertexElement->count - first);
+        vertexChunks.push_back(vertexChunk);
+    }
+    runChunks(vertexChunks, decodePlyVertices);
+
+    mesh.indices.resize(int(indexCount));
+    for (int i = 0; i < faceChunks.size(); i++) {
+        faceChunks[i].vertexCount = quint32(vertexElement->count);
+        faceChunks[i].indices = mesh.indices.data();
+    }
+    runChunks(faceChunks, decodePlyFaces);
+    if (isCanceled()) return false;
+    for (int i = 0; i < faceChunks.size(); i++)
+        if (faceChunks[i].invalid) {
+            m_error = "Face refers to a missing vertex";
+            return false;
+        }
+
+    if (!hasNormals)
+        generateNormals(mesh.vertices, mesh.indices, QVector<int>(), mesh.vertices.size(), m_maxSmoothingAngle);
+    if (mesh.tangents && hasTexCoords)
+        generateTangents(mesh.vertices, mesh.indices);
+    m_meshes.push_back(mesh);
+    return true;
+}
+
+// Binary STL files are fixed size records of a normal and three corners, every
+// corner becomes a vertex of its own like with Assimp
+
+struct StlChunk {
+    const uchar* data;
+    int first, count;
+    Vertex* vertices;
+    const QFutureInterfaceBase* future;
+};
+
+static void decodeStlTriangles(StlChunk& chunk) {
+    if (chunk.future && chunk.future->isCanceled()) return;
+    for (int t = chunk.first; t < chunk.first + chunk.count; t++) {
+        const uchar* record = chunk.data + qint64(t) * 50;
+        Vertex* corners = chunk.vertices + qint64(t) * 3;
+        QVector3D normal;
+        memcpy(&normal, record, sizeof(QVector3D));
+        for (int k = 0; k < 3; k++)
+            memcpy(&corners[k].position, record + 12 + k * 12, sizeof(QVector3D));
+        if (!(normal.lengthSquared() > FLT_MIN)) // also NaN
+            normal = QVector3D::crossProduct(corners[1].position - corners[0].position,
+                                             corners[2].position - corners[0].position);
+        normal.normalize();
+        for (int k = 0; k < 3; k++)
+            corners[k].normal = normal;
+    }
+}
+
+bool NativeModelReader::readStl(QString filePath, const char * data, qint64 size) {
+    quint32 triangleCount = 0;
+    if (size >= 84)
+        memcpy(&triangleCount, data + 80, 4);
+    if (size < 84 || size != 84 + qint64(triangleCount) * 50) {
+        m_error = "Only binary files are supported";
+        return false;
+    }
+
+    // Every corner is a vertex of its own, so files above maxPartTriangles become
+    // several meshes
+    int partCount = int((qint64(triangleCount) + maxPartTriangles - 1) / maxPartTriangles);
+    int firstPart = m_meshes.size();
+    m_meshes.reserve(firstPart + partCount);
+    for (int part = 0; part < partCount; part++) {
+        int count = int(qMin(qint64(maxPartTriangles), qint64(triangleCount) - qint64(part) * maxPartTriangles));
+        m_meshes.push_back(MeshData());
+        MeshData& mesh = m_meshes.back();
+        mesh.name = QFileInfo(filePath).baseName();
+        if (partCount > 1) mesh.name += QString(" %1").arg(part + 1);
+        mesh.material = -1;
+        mesh.tangents = m_tangentMode == AllTangents;
+        mesh.vertices.resize(count * 3);
+        mesh.indices.resize(count * 3);
+        for (int i = 0; i < mesh.indices.size(); i++)
+            mesh.indices[i] = uint32_t(i);
+    }
+
+    QVector<StlChunk> chunks;
+    for (int part = 0; part < partCount; part++) {
+        MeshData& mesh = m_meshes[firstPart + part];
+        const uchar* records = reinterpret_cast<const uchar*>(data) + 84 + qint64(part) * maxPartTriangles * 50;
+        int count = mesh.vertices.size() / 3;
+        for (int first = 0; first < count; first += recordChunkSize) {
+            StlChunk chunk = { records, first, qMin(recordChunkSize, count - first), mesh.vertices.data(), m_future };
+            chunks.push_back(chunk);
+        }
+    }
+    runChunks(chunks, decodeStlTriangles);
+    if (isCanceled()) return false;
+
+    // Without texture coordinates there's nothing to derive tangents from, the
+    // vertices keep the default frame as they would with Assimp
+    return true;
+}
@@ -0,0 +1,209 @@
+#include <Primitive.h>
+#include <ModelLoader.h>
+
+QHash<QString, Mesh*> Primitive::m_prototypes;
+QMutex Primitive::m_mutex;
+
+static const float pi = 3.1415926f;
+
+// Same tangent frame conventions as imported meshes, see ModelLoader::loadMesh
+static void addVertex(QVector<Vertex>& vertices, QVector3D position, QVector3D normal,
+                      QVector3D tangent, QVector3D bitangent, QVector2D texCoords) {
+    tangent -= QVector3D::dotProduct(tangent, normal) * normal;
+    tangent.normalize();
+    if (QVector3D::dotProduct(QVector3D::crossProduct(tangent, normal), bitangent) < 0.0f)
+        tangent = -tangent;
+    vertices.push_back(Vertex(position, normal, tangent, bitangent.normalized(), texCoords));
+}
+
+// Wound counter-clockwise around the vertex normals, degenerate triangles are dropped
+static void addTriangle(const QVector<Vertex>& vertices, QVector<uint32_t>& indices, uint32_t a, uint32_t b, uint32_t c) {
+    QVector3D n = QVector3D::crossProduct(vertices[b].position - vertices[a].position,
+                                          vertices[c].position - vertices[a].position);
+    if (n.lengthSquared() < eps * eps) return;
+    if (QVector3D::dotProduct(n, vertices[a].normal + vertices[b].normal + vertices[c].normal) < 0.0f)
+        qSwap(b, c);
+    indices.push_back(a);
+    indices.push_back(b);
+    indices.push_back(c);
+}
+
+static Mesh* createMesh(QString name, QVector<Vertex>& vertices, QVector<uint32_t>& indices) {
+    Mesh* mesh = new Mesh(Mesh::Triangle);
+    mesh->setObjectName(name);
+    mesh->setGeometry(std::move(vertices), std::move(indices));
+    mesh->setMaterial(new Material);
+    return mesh;
+}
+
+// A disk of radius 1 at height y facing +Y or -Y
+static void addCap(QVector<Vertex>& vertices, QVector<uint32_t>& indices, int segments, float y, float facing) {
+    QVector3D normal(0, facing, 0);
+    uint32_t center = uint32_t(vertices.size());
+    addVertex(vertices, QVector3D(0, y, 0), normal, QVector3D(1, 0, 0), QVector3D(0, 0, -facing), QVector2D(0.5f, 0.5f));
+    for (int i = 0; i <= segments; i++) {
+        float phi = 2.0f * pi * i / segments;
+        QVector3D p(cosf(phi), y, -sinf(phi));
+        addVertex(vertices, p, normal, QVector3D(1, 0, 0), QVector3D(0, 0, -facing),
+                  QVector2D(p.x() * 0.5f + 0.5f, -p.z() * facing * 0.5f + 0.5f));
+    }
+    for (int i = 0; i < segments; i++)
+        addTriangle(vertices, indices, center, center + 1 + i, center + 2 + i);
+}
+
+Mesh * Primitive::cone(int segments) {
+    return copy("Cone " + QString::number(segments), generateCone, qMax(3, segments), 0);
+}
+
+Mesh * Primitive::cube() {
+    return copy("Cube", generateCube, 0, 0);
+}
+
+Mesh * Primitive::cylinder(int segments) {
+    return copy("Cylinder " + QString::number(segments), generateCylinder, qMax(3, segments), 0);
+}
+
+Mesh * Primitive::plane(int divisions) {
+    return copy("Plane " + QString::number(divisions), generatePlane, qMax(1, divisions), 0);
+}
+
+Mesh * Primitive::sphere(int segments, int rings) {
+    return copy("Sphere " + QString::number(segments) + " " + QString::number(rings),
+                generateSphere, qMax(3, segments), qMax(2, rings));
+}
+
+Mesh * Primitive::resourceMesh(QString filePath) {
+    QMutexLocker locker(&m_mutex);
+    Mesh* prototype = m_prototypes.value(filePath, 0);
+    if (!prototype) {
+        ModelLoader loader;
+        prototype = loader.loadMeshFromFile(filePath);
+        m_prototypes[filePath] = prototype;
+    }
+    return new Mesh(*prototype);
+}
+
+// The prototypes are kept for the lifetime of the application
+Mesh * Primitive::copy(QString key, Mesh* (*generate)(int, int), int a, int b) {
+    QMutexLocker locker(&m_mutex);
+    Mesh* prototype = m_prototypes.value(key, 0);
+    if (!prototype) {
+        prototype = generate(a, b);
+        m_prototypes[key] = prototype;
+    }
+    return new Mesh(*prototype);
+}
+
+Mesh * Primitive::generateCone(int segments, int) {
+    QVector<Vertex> vertices;
+    QVector<uint32_t> indices;
+
+    // One apex vertex per segment so that every side keeps its own normal
+    for (int i = 0; i <= segments; i++) {
+        float phi = 2.0f * pi * i / segments;
+        float apexPhi = 2.0f * pi * (i + 0.5f) / segments;
+        QVector3D tangent(-sinf(phi), 0, -cosf(phi));
+        QVector3D normal = QVector3D(cosf(phi), 1, -sinf(phi)).normalized();
+        QVector3D apexNormal = QVector3D(cosf(apexPhi), 1, -sinf(apexPhi)).normalized();
+        addVertex(vertices, QVector3D(cosf(phi), -0.5f, -sinf(phi)), normal, tangent,
+                  QVector3D(-cosf(phi), 1, sinf(phi)), QVector2D(float(i) / segments, 0));
+        addVertex(vertices, QVector3D(0, 0.5f, 0), apexNormal, tangent,
+                  QVector3D(-cosf(phi), 1, sinf(phi)), QVector2D((i + 0.5f) / segments, 1));
+    }
+    for (int i = 0; i < segments; i++)
+        addTriangle(vertices, indices, uint32_t(i * 2), uint32_t(i * 2 + 2), uint32_t(i * 2 + 1));
+    addCap(vertices, indices, segments, -0.5f, -1.0f);
+
+    return createMesh("Cone", vertices, indices);
+}
+
+Mesh * Primitive::generateCube(int, int) {
+    QVector<Vertex> vertices;
+    QVector<uint32_t> indices;
+
+    const QVector3D normals[6] = { QVector3D(1, 0, 0), QVector3D(-1, 0, 0), QVector3D(0, 1, 0),
+                                   QVector3D(0, -1, 0), QVector3D(0, 0, 1), QVector3D(0, 0, -1) };
+    const QVector3D tangents[6] = { QVector3D(0, 0, -1), QVector3D(0, 0, 1), QVector3D(1, 0, 0),
+                                    QVector3D(1, 0, 0), QVector3D(1, 0, 0), QVector3D(-1, 0, 0) };
+    for (int f = 0; f < 6; f++) {
+        // u, v and the normal form a right-handed frame
+        QVector3D u = tangents[f], v = QVector3D::crossProduct(normals[f], u);
+        uint32_t base = uint32_t(vertices.size());
+        for (int k = 0; k < 4; k++) {
+            float s = (k == 1 || k == 2) ? 1.0f : 0.0f, t = k >= 2 ? 1.0f : 0.0f;
+            addVertex(vertices, normals[f] * 0.5f + u * (s - 0.5f) + v * (t - 0.5f), normals[f], u, v, QVector2D(s, t));
+        }
+        addTriangle(vertices, indices, base, base + 1, base + 2);
+        addTriangle(vertices, indices, base, base + 2, base + 3);
+    }
+
+    return createMesh("Cube", vertices, indices);
+}
+
+Mesh * Primitive::generateCylinder(int segments, int) {
+    QVector<Vertex> vertices;
+    QVector<uint32_t> indices;
+
+    for (int i = 0; i <= segments; i++) {
+        float phi = 2.0f * pi * i / segments;
+        QVector3D normal(cosf(phi), 0, -sinf(phi));
+        QVector3D tangent(-sinf(phi), 0, -cosf(phi));
+        addVertex(vertices, normal + QVector3D(0, -0.5f, 0), normal, tangent, QVector3D(0, 1, 0), QVector2D(float(i) / segments, 0));
+        addVertex(vertices, normal + QVector3D(0, 0.5f, 0), normal, tangent, QVector3D(0, 1, 0), QVector2D(float(i) / segments, 1));
+    }
+    for (int i = 0; i < segments; i++) {
+        uint32_t a = uint32_t(i * 2);
+        addTriangle(vertices, indices, a, a + 2, a + 3);
+        addTriangle(vertices, indices, a, a + 3, a + 1);
+    }
+    addCap(vertices, indices, segments, 0.5f, 1.0f);
+    addCap(vertices, indices, segments, -0.5f, -1.0f);
+
+    return createMesh("Cylinder", vertices, indices);
+}
+
+Mesh * Primitive::generatePlane(int divisions, int) {
+    QVector<Vertex> vertices;
+    QVector<uint32_t> indices;
+
+    for (int j = 0; j <= divisions; j++)
+        for (int i = 0; i <= divisions; i++) {
+            float s = float(i) / divisions, t = float(j) / divisions;
+            addVertex(vertices, QVector3D(s - 0.5f, 0, 0.5f - t), QVector3D(0, 1, 0),
+                      QVector3D(1, 0, 0), QVector3D(0, 0, -1), QVector2D(s, t));
+        }
+    for (int j = 0; j < divisions; j++)
+        for (int i = 0; i < divisions; i++) {
+            uint32_t a = uint32_t(j * (divisions + 1) + i), b = a + uint32_t(divisions + 1);
+            addTriangle(vertices, indices, a, a + 1, b + 1);
+            addTriangle(vertices, indices, a, b + 1, b);
+        }
+
+    return createMesh("Plane", vertices, indices);
+}
+
+Mesh * Primitive::generateSphere(int segments, int rings) {
+    QVector<Vertex> vertices;
+    QVector<uint32_t> indices;
+
+    // Latitude rings from the north to the south pole, the seam and the poles are
+    // duplicated so that every vertex has its own texture coordinates
+    for (int j = 0; j <= rings; j++) {
+        float theta = pi * j / rings;
+        for (int i = 0; i <= segments; i++) {
+            float phi = 2.0f * pi * i / segments;
+            QVector3D normal(sinf(theta) * cosf(phi), cosf(theta), -sinf(theta) * sinf(phi));
+            QVector3D tangent(-sinf(phi), 0, -cosf(phi));
+            QVector3D bitangent(-cosf(theta) * cosf(phi), sinf(theta), cosf(theta) * sinf(phi));
+            addVertex(vertices, normal, normal, tangent, bitangent, QVector2D(float(i) / segments, 1.0f - float(j) / rings));
+        }
+    }
+    for (int j = 0; j < rings; j++)
+        for (int i = 0; i < segments; i++) {
+            uint32_t a = uint32_t(j * (segments + 1) + i), b = a + uint32_t(segments + 1);
+            addTriangle(vertices, indices, a, b, b + 1);
+            addTriangle(vertices, indices, a, b + 1, a + 1);
+        }
+
+    return createMesh("Sphere", vertices, indices);
+}
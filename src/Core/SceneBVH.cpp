@@ -0,0 +1,405 @@
+#include <SceneBVH.h>
+#include <FrustumCuller.h>
+#include <QVarLengthArray>
+#include <queue>
+
+static inline float halfArea(const AABB& box) {
+    if (box.isEmpty()) return 0.0f;
+    QVector3D d = box.maximum - box.minimum;
+    return d.x() * d.y() + d.y() * d.z() + d.z() * d.x();
+}
+
+static inline AABB merged(const AABB& a, const AABB& b) {
+    AABB box = a;
+    box.merge(b);
+    return box;
+}
+
+static inline bool overlaps(const AABB& a, const AABB& b) {
+    for (int i = 0; i < 3; i++)
+        if (a.minimum[i] > b.maximum[i] || a.maximum[i] < b.minimum[i])
+            return false;
+    return !a.isEmpty() && !b.isEmpty();
+}
+
+static inline float squaredDistance(QVector3D p, const AABB& box) {
+    float d = 0.0f;
+    for (int i = 0; i < 3; i++) {
+        float v = qMax(qMax(box.minimum[i] - p[i], p[i] - box.maximum[i]), 0.0f);
+        d += v * v;
+    }
+    return d;
+}
+
+// Whether every corner of the box lies inside all planes
+static inline bool contains(const Frustum& frustum, const AABB& box) {
+    for (int i = 0; i < 6; i++) {
+        const QVector4D& plane = frustum.planes[i];
+        // The corner furthest against the plane normal
+        QVector3D p(plane.x() >= 0 ? box.minimum.x() : box.maximum.x(),
+                    plane.y() >= 0 ? box.minimum.y() : box.maximum.y(),
+                    plane.z() >= 0 ? box.minimum.z() : box.maximum.z());
+        if (QVector3D::dotProduct(plane.toVector3D(), p) + plane.w() < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+SceneBVH::SceneBVH() {
+    m_root = -1;
+    m_freeList = -1;
+    m_leafCount = 0;
+}
+
+int SceneBVH::insert(Mesh * mesh, const AABB & box) {
+    int leaf = allocateNode();
+    m_nodes[leaf].box = box;
+    m_nodes[leaf].mesh = mesh;
+    insertLeaf(leaf);
+    m_leafCount++;
+    return leaf;
+}
+
+void SceneBVH::remove(int proxy) {
+    removeLeaf(proxy);
+    freeNode(proxy);
+    m_leafCount--;
+}
+
+bool SceneBVH::update(int proxy, const AABB & box) {
+    Node& leaf = m_nodes[proxy];
+    if (leaf.box.minimum == box.minimum && leaf.box.maximum == box.maximum)
+        return false;
+    leaf.box = box;
+    refit(leaf.parent);
+    return true;
+}
+
+// Rebuild the inner nodes from the leaves with the binned SAH builder, the
+// leaves themselves and so the proxies are kept
+void SceneBVH::rebuild() {
+    QVector<int> leaves;
+    QVector<AABB> boxes;
+    leaves.reserve(m_leafCount);
+    boxes.reserve(m_leafCount);
+    for (int i = 0; i < m_nodes.size(); i++) {
+        if (m_nodes[i].mesh) {
+            leaves.push_back(i);
+            boxes.push_back(m_nodes[i].box);
+        } else if (m_nodes[i].child[0] >= 0)
+            freeNode(i);
+    }
+    m_root = -1;
+    if (leaves.isEmpty()) return;
+
+    BVH tree;
+    tree.build(boxes, 1);
+    const QVector<BVH::Node>& nodes = tree.nodes();
+    const QVector<int>& primitives = tree.primitives();
+
+    // Parents of the tree nodes are created before their children, so walking the
+    // nodes backwards meets every child before the node that links it
+    QVector<int> mapped(nodes.size(), -1);
+    for (int i = nodes.size() - 1; i >= 0; i--) {
+        int node;
+        if (nodes[i].count > 0) {
+            // Small leaves of the SAH tree become a chain of inner nodes
+            node = leaves[primitives[nodes[i].first]];
+            for (int j = nodes[i].first + 1; j < nodes[i].first + nodes[i].count; j++) {
+                int parent = allocateNode();
+                int leaf = leaves[primitives[j]];
+                m_nodes[parent].child[0] = node;
+                m_nodes[parent].child[1] = leaf;
+                m_nodes[parent].box = merged(m_nodes[node].box, m_nodes[leaf].box);
+                m_nodes[node].parent = m_nodes[leaf].parent = parent;
+                node = parent;
+            }
+        } else {
+            node = allocateNode();
+            int left = mapped[i + 1], right = mapped[nodes[i].first];
+            m_nodes[node].child[0] = left;
+            m_nodes[node].child[1] = right;
+            m_nodes[node].box = merged(m_nodes[left].box, m_nodes[right].box);
+            m_nodes[left].parent = m_nodes[right].parent = node;
+        }
+        mapped[i] = node;
+    }
+    m_root = mapped[0];
+    m_nodes[m_root].parent = -1;
+}
+
+void SceneBVH::clear() {
+    m_nodes.clear();
+    m_root = -1;
+    m_freeList = -1;
+    m_leafCount = 0;
+}
+
+int SceneBVH::size() const {
+    return m_leafCount;
+}
+
+Mesh * SceneBVH::mesh(int proxy) const {
+    return m_nodes[proxy].mesh;
+}
+
+const AABB & SceneBVH::box(int proxy) const {
+    return m_nodes[proxy].box;
+}
+
+AABB SceneBVH::bounds() const {
+    return m_root >= 0 ? m_nodes[m_root].box : AABB();
+}
+
+float SceneBVH::cost() const {
+    float cost = 0.0f;
+    for (int i = 0; i < m_nodes.size(); i++)
+        if (m_nodes[i].child[0] >= 0)
+            cost += halfArea(m_nodes[i].box);
+    return cost;
+}
+
+void SceneBVH::query(const Frustum & frustum, QVector<Mesh*>& meshes) const {
+    if (m_root < 0) return;
+
+    // Inner nodes are tested one by one on the way down, the leaves below partially
+    // visible nodes are gathered and tested in batches at the end
+    QVarLengthArray<int, 64> stack;
+    QVector<int> candidates;
+    QVector<AABB> boxes;
+    stack.append(m_root);
+    while (!stack.isEmpty()) {
+        const Node& node = m_nodes[stack.last()];
+        stack.removeLast();
+        if (node.mesh) {
+            candidates.push_back(int(&node - m_nodes.constData()));
+            boxes.push_back(node.box);
+        } else if (!frustum.intersects(node.box))
+            continue;
+        else if (contains(frustum, node.box))
+            collectLeaves(int(&node - m_nodes.constData()), meshes);
+        else {
+            stack.append(node.child[0]);
+            stack.append(node.child[1]);
+        }
+    }
+
+    QVector<int> visible;
+    FrustumCuller(frustum).cull(boxes.constData(), boxes.size(), visible);
+    for (int i = 0; i < visible.size(); i++)
+        meshes.push_back(m_nodes[candidates[visible[i]]].mesh);
+}
+
+void SceneBVH::query(const AABB & box, QVector<Mesh*>& meshes) const {
+    if (m_root < 0) return;
+    QVarLengthArray<int, 64> stack;
+    stack.append(m_root);
+    while (!stack.isEmpty()) {
+        const Node& node = m_nodes[stack.last()];
+        stack.removeLast();
+        if (!overlaps(node.box, box)) continue;
+        if (node.mesh)
+            meshes.push_back(node.mesh);
+        else {
+            stack.append(node.child[0]);
+            stack.append(node.child[1]);
+        }
+    }
+}
+
+struct StackEntry {
+    int node;
+    float entry;
+};
+
+// Slab test on a box of this tree, through the padded layout of BVH nodes
+static inline bool intersects(const AABB& box, const Ray& ray, float maxDistance, float& entry) {
+    BVH::Node node;
+    for (int k = 0; k < 3; k++) {
+        node.minimum[k] = box.minimum[k];
+        node.maximum[k] = box.maximum[k];
+    }
+    node.minimum[3] = 0.0f;
+    node.maximum[3] = FLT_MAX;
+    return BVH::intersects(node, ray, maxDistance, entry);
+}
+
+void SceneBVH::raycast(const Ray & ray, float maxDistance, BVH::RayVisitor & visitor) const {
+    if (m_root < 0) return;
+    StackEntry root = { m_root, 0.0f };
+    if (!intersects(m_nodes[m_root].box, ray, maxDistance, root.entry)) return;
+
+    QVarLengthArray<StackEntry, 64> stack;
+    stack.append(root);
+    while (!stack.isEmpty()) {
+        StackEntry current = stack.last();
+        stack.removeLast();
+        if (current.entry > maxDistance) continue;
+
+        const Node& node = m_nodes[current.node];
+        if (node.mesh) {
+            visitor.visit(current.node, maxDistance);
+            continue;
+        }
+
+        StackEntry left = { node.child[0], 0.0f }, right = { node.child[1], 0.0f };
+        bool hitLeft = intersects(m_nodes[left.node].box, ray, maxDistance, left.entry);
+        bool hitRight = intersects(m_nodes[right.node].box, ray, maxDistance, right.entry);
+        if (hitLeft && hitRight) {
+            stack.append(left.entry < right.entry ? right : left);
+            stack.append(left.entry < right.entry ? left : right);
+        } else if (hitLeft)
+            stack.append(left);
+        else if (hitRight)
+            stack.append(right);
+    }
+}
+
+struct NearestEntry {
+    float distance;
+    int node;
+
+    bool operator<(const NearestEntry& entry) const {
+        return distance > entry.distance; // smallest distance on top
+    }
+};
+
+void SceneBVH::nearest(QVector3D point, int k, QVector<Mesh*>& meshes) const {
+    if (m_root < 0 || k <= 0) return;
+    std::priority_queue<NearestEntry> queue;
+    NearestEntry root = { squaredDistance(point, m_nodes[m_root].box), m_root };
+    queue.push(root);
+    int found = 0;
+    while (!queue.empty() && found < k) {
+        NearestEntry current = queue.top();
+        queue.pop();
+        const Node& node = m_nodes[current.node];
+        if (node.mesh) {
+            meshes.push_back(node.mesh);
+            found++;
+            continue;
+        }
+        for (int i = 0; i < 2; i++) {
+            NearestEntry child = { squaredDistance(point, m_nodes[node.child[i]].box), node.child[i] };
+            queue.push(child);
+        }
+    }
+}
+
+int SceneBVH::allocateNode() {
+    int node;
+    if (m_freeList >= 0) {
+        node = m_freeList;
+        m_freeList = m_nodes[node].next;
+    } else {
+        node = m_nodes.size();
+        m_nodes.push_back(Node());
+    }
+    m_nodes[node].box = AABB();
+    m_nodes[node].mesh = 0;
+    m_nodes[node].parent = -1;
+    m_nodes[node].child[0] = m_nodes[node].child[1] = -1;
+    m_nodes[node].next = -1;
+    return node;
+}
+
+void SceneBVH::freeNode(int node) {
+    m_nodes[node].mesh = 0;
+    m_nodes[node].child[0] = m_nodes[node].child[1] = -1;
+    m_nodes[node].next = m_freeList;
+    m_freeList = node;
+}
+
+// Pair the leaf with the sibling that grows the surface area the least
+void SceneBVH::insertLeaf(int leaf) {
+    if (m_root < 0) {
+        m_root = leaf;
+        m_nodes[leaf].parent = -1;
+        return;
+    }
+
+    AABB box = m_nodes[leaf].box;
+    int index = m_root;
+    while (m_nodes[index].child[0] >= 0) {
+        const Node& node = m_nodes[index];
+        float area = halfArea(node.box);
+        float combinedArea = halfArea(merged(node.box, box));
+        float cost = 2.0f * combinedArea;               // new parent of this node and the leaf
+        float inheritance = 2.0f * (combinedArea - area); // growth pushed onto the ancestors
+
+        float childCost[2];
+        for (int i = 0; i < 2; i++) {
+            const Node& child = m_nodes[node.child[i]];
+            float enlarged = halfArea(merged(child.box, box));
+            childCost[i] = (child.child[0] < 0 ? enlarged : enlarged - halfArea(child.box)) + inheritance;
+        }
+        if (cost < childCost[0] && cost < childCost[1]) break;
+        index = childCost[0] < childCost[1] ? node.child[0] : node.child[1];
+    }
+
+    int sibling = index;
+    int oldParent = m_nodes[sibling].parent;
+    int newParent = allocateNode();
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].box = merged(m_nodes[sibling].box, box);
+    m_nodes[newParent].child[0] = sibling;
+    m_nodes[newParent].child[1] = leaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    if (oldParent < 0)
+        m_root = newParent;
+    else {
+        Node& parent = m_nodes[oldParent];
+        parent.child[parent.child[0] == sibling ? 0 : 1] = newParent;
+        refit(oldParent);
+    }
+}
+
+// Replace the parent of the leaf with its sibling
+void SceneBVH::removeLeaf(int leaf) {
+    if (leaf == m_root) {
+        m_root = -1;
+        return;
+    }
+
+    int parent = m_nodes[leaf].parent;
+    int grandParent = m_nodes[parent].parent;
+    int sibling = m_nodes[parent].child[0] == leaf ? m_nodes[parent].child[1] : m_nodes[parent].child[0];
+    freeNode(parent);
+
+    m_nodes[sibling].parent = grandParent;
+    if (grandParent < 0)
+        m_root = sibling;
+    else {
+        Node& node = m_nodes[grandParent];
+        node.child[node.child[0] == parent ? 0 : 1] = sibling;
+        refit(grandParent);
+    }
+}
+
+// Recompute the boxes from `node` up, stopping where a box doesn't change
+void SceneBVH::refit(int node) {
+    while (node >= 0) {
+        AABB box = merged(m_nodes[m_nodes[node].child[0]].box, m_nodes[m_nodes[node].child[1]].box);
+        if (box.minimum == m_nodes[node].box.minimum && box.maximum == m_nodes[node].box.maximum)
+            break;
+        m_nodes[node].box = box;
+        node = m_nodes[node].parent;
+    }
+}
+
+void SceneBVH::collectLeaves(int node, QVector<Mesh*>& meshes) const {
+    QVarLengthArray<int, 64> stack;
+    stack.append(node);
+    while (!stack.isEmpty()) {
+        const Node& current = m_nodes[stack.last()];
+        stack.removeLast();
+        if (current.mesh)
+            meshes.push_back(current.mesh);
+        else {
+            stack.append(current.child[0]);
+            stack.append(current.child[1]);
+        }
+    }
+}
@@ -1,37 +1,116 @@
-#include <TextureLoader.h>
-
-QHash<QString, QWeakPointer<Texture>> TextureLoader::cache;
-
-QSharedPointer<Texture> TextureLoader::loadFromFile(Texture::TextureType textureType, QString filePath) {
-    if (cache[filePath].isNull()) {
-        if (log_level >= LOG_LEVEL_INFO)
-            dout << "Loading" << filePath;
-        QSharedPointer<Texture> texture(new Texture(textureType));
-        QImageReader reader(filePath);
-        texture->setObjectName(filePath);
-        texture->setImage(reader.read());
-
-        if (texture->image().isNull()) {
-            m_log += "Failed to load texture " + filePath + ": " + reader.errorString() + '\n';
-            if (log_level >= LOG_LEVEL_ERROR)
-                dout << "Failed to load texture:" << reader.errorString();
-            return QSharedPointer<Texture>();
-        }
-
-        cache[filePath] = texture;
-        return texture;
-    }
-    if (log_level >= LOG_LEVEL_INFO)
-        dout << filePath << "found in cache";
-    return cache[filePath];
-}
-
-bool TextureLoader::hasErrorLog() {
-    return m_log != "";
-}
-
-QString TextureLoader::errorLog() {
-    QString tmp = m_log;
-    m_log = "";
-    return tmp;
-}
+#include <TextureLoader.h>
+#include <ImportCache.h>
+
+QHash<QString, QWeakPointer<Texture>> TextureLoader::cache;
+QMutex TextureLoader::cacheMutex;
+
+// Neutral values shown until the image is decoded: white for color and specular
+// maps, a flat normal for bump maps
+static QImage placeholderImage(Texture::TextureType textureType) {
+    QImage image(1, 1, QImage::Format_RGB32);
+    image.fill(textureType == Texture::Bump ? QColor(128, 128, 255) : QColor(255, 255, 255));
+    return image;
+}
+
+// Cached pixels are a small header followed by the scan lines as QImage holds them
+struct CachedImageHeader {
+    qint32 width, height, bytesPerLine, format;
+};
+
+// Keeps the mapping of a cache entry alive while an image points into it
+static void releaseCachedImage(void* entry) {
+    delete static_cast<QSharedPointer<ImportCache::Entry>*>(entry);
+}
+
+static QImage loadCachedImage(const QSharedPointer<ImportCache::Entry>& entry) {
+    CachedImageHeader header;
+    if (entry->size() < qint64(sizeof(header))) return QImage();
+    memcpy(&header, entry->data(), sizeof(header));
+    if (header.width <= 0 || header.height <= 0 || header.format <= QImage::Format_Invalid ||
+        header.format >= QImage::NImageFormats ||
+        entry->size() != qint64(sizeof(header)) + qint64(header.bytesPerLine) * header.height)
+        return QImage();
+    // The pixels are used in place, read only
+    return QImage(entry->data() + sizeof(header), header.width, header.height, header.bytesPerLine,
+                  QImage::Format(header.format), releaseCachedImage, new QSharedPointer<ImportCache::Entry>(entry));
+}
+
+static QByteArray cachedImage(const QImage& image) {
+    CachedImageHeader header = { image.width(), image.height(), image.bytesPerLine(), image.format() };
+    QByteArray bytes(reinterpret_cast<const char*>(&header), sizeof(header));
+    bytes.append(reinterpret_cast<const char*>(image.constBits()), image.bytesPerLine() * image.height());
+    return bytes;
+}
+
+static QImage decodeImage(QString filePath) {
+    QString cacheKey = ImportCache::instance()->key(filePath, "texture");
+    if (QSharedPointer<ImportCache::Entry> entry = ImportCache::instance()->find(cacheKey)) {
+        QImage image = loadCachedImage(entry);
+        if (!image.isNull()) return image;
+    }
+
+    QImageReader reader(filePath);
+    QImage image = reader.read();
+    if (image.isNull()) {
+        if (log_level >= LOG_LEVEL_ERROR)
+            dout << "Failed to load texture" << filePath << ":" << reader.errorString();
+        return image;
+    }
+    if (!cacheKey.isEmpty())
+        ImportCache::instance()->insert(cacheKey, cachedImage(image));
+    return image;
+}
+
+// The cache is only locked to look the path up and to insert the new texture, the
+// file is probed in between
+QSharedPointer<Texture> TextureLoader::loadFromFile(Texture::TextureType textureType, QString filePath) {
+    QSharedPointer<Texture> texture = cachedTexture(filePath);
+    if (texture) return texture;
+
+    // Only the header is read here, failing early keeps the error in the log
+    QImageReader reader(filePath);
+    if (!reader.canRead()) {
+        m_log += "Failed to load texture " + filePath + ": " + reader.errorString() + '\n';
+        if (log_level >= LOG_LEVEL_ERROR)
+            dout << "Failed to load texture:" << reader.errorString();
+        return QSharedPointer<Texture>();
+    }
+
+    if (log_level >= LOG_LEVEL_INFO)
+        dout << "Loading" << filePath;
+    texture = QSharedPointer<Texture>(new Texture(textureType));
+    texture->setObjectName(filePath);
+    texture->setImage(placeholderImage(textureType), QtConcurrent::run(decodeImage, filePath));
+
+    // Another import may have loaded the same file meanwhile, the first one is kept
+    // and the image decoded for this one is thrown away
+    QMutexLocker locker(&cacheMutex);
+    QSharedPointer<Texture> loaded = cache.value(filePath).toStrongRef();
+    if (loaded) return loaded;
+
+    // Textures loaded by an import thread are shared by the whole application
+    if (QCoreApplication::instance() && texture->thread() != QCoreApplication::instance()->thread())
+        texture->moveToThread(QCoreApplication::instance()->thread());
+
+    cache[filePath] = texture;
+    return texture;
+}
+
+QSharedPointer<Texture> TextureLoader::cachedTexture(QString filePath) {
+    QMutexLocker locker(&cacheMutex);
+    QSharedPointer<Texture> texture = cache.value(filePath).toStrongRef();
+    // Found decoded or still being decoded, either way it is shared
+    if (texture && log_level >= LOG_LEVEL_INFO)
+        dout << filePath << "found in cache";
+    return texture;
+}
+
+bool TextureLoader::hasErrorLog() {
+    return m_log != "";
+}
+
+QString TextureLoader::errorLog() {
+    QString tmp = m_log;
+    m_log = "";
+    return tmp;
+}
@@ -1,61 +1,269 @@
-#include <Vertex.h>
-
-Vertex::Vertex(QVector3D _position, QVector3D _normal, QVector3D _tangent, QVector3D _bitangent, QVector2D _texCoords) {
-    position = _position;
-    normal = _normal;
-    tangent = _tangent;
-    bitangent = _bitangent;
-    texCoords = _texCoords;
-}
-
-Vertex::Vertex(const Vertex & other) {
-    position = other.position;
-    normal = other.normal;
-    tangent = other.tangent;
-    bitangent = other.bitangent;
-    texCoords = other.texCoords;
-}
-
-Vertex & Vertex::operator=(const Vertex & other) {
-    position = other.position;
-    normal = other.normal;
-    tangent = other.tangent;
-    bitangent = other.bitangent;
-    texCoords = other.texCoords;
-    return *this;
-}
-
-bool Vertex::operator==(const Vertex & other) const {
-    return position == other.position
-        && normal == other.normal
-        && tangent == other.tangent
-        && bitangent == other.bitangent
-        && texCoords == other.texCoords;
-}
-
-Vertex operator*(QMatrix4x4 mat, const Vertex & vertex) {
-    Vertex t = vertex;
-    t.position = mat * t.position;
-    t.tangent = mat * t.tangent;
-    t.bitangent = mat * t.bitangent;
-    t.normal = QMatrix4x4(mat.normalMatrix()) * t.normal;
-    return t;
-}
-
-QDataStream &operator<<(QDataStream &out, const Vertex& vertex) {
-    out << vertex.position;
-    out << vertex.normal;
-    out << vertex.tangent;
-    out << vertex.bitangent;
-    out << vertex.texCoords;
-    return out;
-}
-
-QDataStream &operator>>(QDataStream &in, Vertex& vertex) {
-    in >> vertex.position;
-    in >> vertex.normal;
-    in >> vertex.tangent;
-    in >> vertex.bitangent;
-    in >> vertex.texCoords;
-    return in;
-}
+#include <Vertex.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VERTEX_USE_SSE2
+#endif
+
+// The AVX kernel is compiled for that target alone and only called if the CPU has it
+#if defined(VERTEX_USE_SSE2) && (defined(__GNUC__) || defined(_MSC_VER))
+#include <immintrin.h>
+#define VERTEX_USE_AVX
+#ifdef __GNUC__
+#define VERTEX_TARGET_AVX __attribute__((target("avx")))
+#else
+#include <intrin.h>
+#define VERTEX_TARGET_AVX
+#endif
+#endif
+
+// The kernels below address the components of QVector3D as a float[3]
+static_assert(sizeof(QVector3D) == 3 * sizeof(float), "unexpected QVector3D layout");
+
+Vertex::Vertex(QVector3D _position, QVector3D _normal, QVector3D _tangent, QVector3D _bitangent, QVector2D _texCoords) {
+    position = _position;
+    normal = _normal;
+    tangent = _tangent;
+    bitangent = _bitangent;
+    texCoords = _texCoords;
+}
+
+Vertex::Vertex(const Vertex & other) {
+    position = other.position;
+    normal = other.normal;
+    tangent = other.tangent;
+    bitangent = other.bitangent;
+    texCoords = other.texCoords;
+}
+
+Vertex & Vertex::operator=(const Vertex & other) {
+    position = other.position;
+    normal = other.normal;
+    tangent = other.tangent;
+    bitangent = other.bitangent;
+    texCoords = other.texCoords;
+    return *this;
+}
+
+bool Vertex::operator==(const Vertex & other) const {
+    return position == other.position
+        && normal == other.normal
+        && tangent == other.tangent
+        && bitangent == other.bitangent
+        && texCoords == other.texCoords;
+}
+
+Vertex operator*(QMatrix4x4 mat, const Vertex & vertex) {
+    Vertex t;
+    transformVertices(mat, &vertex, &t, 1);
+    return t;
+}
+
+static void transformVerticesScalar(const QMatrix4x4 & mat, const Vertex * src, Vertex * dst, int count) {
+    QMatrix3x3 normalMat = mat.normalMatrix();
+    float m[3][4], n[3][3];
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 4; c++)
+            m[r][c] = mat(r, c);
+        for (int c = 0; c < 3; c++)
+            n[r][c] = normalMat(r, c);
+    }
+
+    for (int i = 0; i < count; i++) {
+        const Vertex& v = src[i];
+        QVector3D p = v.position, nm = v.normal, tg = v.tangent, bt = v.bitangent;
+        Vertex& t = dst[i];
+        t.position = QVector3D(m[0][0] * p[0] + m[0][1] * p[1] + m[0][2] * p[2] + m[0][3],
+                               m[1][0] * p[0] + m[1][1] * p[1] + m[1][2] * p[2] + m[1][3],
+                               m[2][0] * p[0] + m[2][1] * p[1] + m[2][2] * p[2] + m[2][3]);
+        t.normal = QVector3D(n[0][0] * nm[0] + n[0][1] * nm[1] + n[0][2] * nm[2],
+                             n[1][0] * nm[0] + n[1][1] * nm[1] + n[1][2] * nm[2],
+                             n[2][0] * nm[0] + n[2][1] * nm[1] + n[2][2] * nm[2]);
+        t.tangent = QVector3D(m[0][0] * tg[0] + m[0][1] * tg[1] + m[0][2] * tg[2],
+                              m[1][0] * tg[0] + m[1][1] * tg[1] + m[1][2] * tg[2],
+                              m[2][0] * tg[0] + m[2][1] * tg[1] + m[2][2] * tg[2]);
+        t.bitangent = QVector3D(m[0][0] * bt[0] + m[0][1] * bt[1] + m[0][2] * bt[2],
+                                m[1][0] * bt[0] + m[1][1] * bt[1] + m[1][2] * bt[2],
+                                m[2][0] * bt[0] + m[2][1] * bt[1] + m[2][2] * bt[2]);
+        t.texCoords = v.texCoords;
+    }
+}
+
+#ifdef VERTEX_USE_SSE2
+
+static inline __m128 load3(const QVector3D& v) {
+    const float* f = reinterpret_cast<const float*>(&v);
+    return _mm_setr_ps(f[0], f[1], f[2], 0.0f);
+}
+
+static inline void store3(QVector3D& v, __m128 r) {
+    float* f = reinterpret_cast<float*>(&v);
+    _mm_storel_pi(reinterpret_cast<__m64*>(f), r);
+    _mm_store_ss(f + 2, _mm_movehl_ps(r, r));
+}
+
+// c0 * x + c1 * y + c2 * z
+static inline __m128 mul3(const __m128 c[3], __m128 v) {
+    __m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 z = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(c[0], x), _mm_mul_ps(c[1], y)), _mm_mul_ps(c[2], z));
+}
+
+static void transformVerticesSse2(const QMatrix4x4 & mat, const Vertex * src, Vertex * dst, int count) {
+    QMatrix3x3 normalMat = mat.normalMatrix();
+    __m128 m[3], n[3];
+    for (int j = 0; j < 3; j++) {
+        m[j] = _mm_setr_ps(mat(0, j), mat(1, j), mat(2, j), 0.0f);
+        n[j] = _mm_setr_ps(normalMat(0, j), normalMat(1, j), normalMat(2, j), 0.0f);
+    }
+    __m128 translation = _mm_setr_ps(mat(0, 3), mat(1, 3), mat(2, 3), 0.0f);
+
+    for (int i = 0; i < count; i++) {
+        const Vertex& v = src[i];
+        __m128 position = load3(v.position), normal = load3(v.normal);
+        __m128 tangent = load3(v.tangent), bitangent = load3(v.bitangent);
+        Vertex& t = dst[i];
+        store3(t.position, _mm_add_ps(mul3(m, position), translation));
+        store3(t.normal, mul3(n, normal));
+        store3(t.tangent, mul3(m, tangent));
+        store3(t.bitangent, mul3(m, bitangent));
+        t.texCoords = v.texCoords;
+    }
+}
+
+#endif
+
+#ifdef VERTEX_USE_AVX
+
+static bool cpuHasAvx() {
+#ifdef __GNUC__
+    return __builtin_cpu_supports("avx");
+#else
+    // The CPU must have AVX and the OS must save the upper halves of the registers
+    int info[4];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0, avx = (info[2] & (1 << 28)) != 0;
+    return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#endif
+}
+
+// Two attributes per register: the low lane holds the position or the tangent, the
+// high lane the normal or the bitangent. Each lane loads 4 floats from its attribute,
+// the 4th one belongs to the next attribute and is never broadcast.
+static inline VERTEX_TARGET_AVX __m256 load3x2(const QVector3D& a, const QVector3D& b) {
+    __m128 low = _mm_loadu_ps(reinterpret_cast<const float*>(&a));
+    __m128 high = _mm_loadu_ps(reinterpret_cast<const float*>(&b));
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+}
+
+static inline VERTEX_TARGET_AVX __m256 mul3x2(const __m256 c[3], __m256 v) {
+    __m256 x = _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0));
+    __m256 y = _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1));
+    __m256 z = _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2));
+    return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c[0], x), _mm256_mul_ps(c[1], y)), _mm256_mul_ps(c[2], z));
+}
+
+static VERTEX_TARGET_AVX void transformVerticesAvx(const QMatrix4x4 & mat, const Vertex * src, Vertex * dst, int count) {
+    QMatrix3x3 normalMat = mat.normalMatrix();
+    __m256 pn[3], tb[3]; // [matrix | normal matrix] and [matrix | matrix] columns
+    for (int j = 0; j < 3; j++) {
+        pn[j] = _mm256_setr_ps(mat(0, j), mat(1, j), mat(2, j), 0.0f,
+                               normalMat(0, j), normalMat(1, j), normalMat(2, j), 0.0f);
+        tb[j] = _mm256_setr_ps(mat(0, j), mat(1, j), mat(2, j), 0.0f,
+                               mat(0, j), mat(1, j), mat(2, j), 0.0f);
+    }
+    __m256 translation = _mm256_setr_ps(mat(0, 3), mat(1, 3), mat(2, 3), 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+
+    for (int i = 0; i < count; i++) {
+        const Vertex& v = src[i];
+        __m256 positionNormal = load3x2(v.position, v.normal);
+        __m256 tangentBitangent = load3x2(v.tangent, v.bitangent);
+        QVector2D texCoords = v.texCoords;
+        __m256 r0 = _mm256_add_ps(mul3x2(pn, positionNormal), translation);
+        __m256 r1 = mul3x2(tb, tangentBitangent);
+
+        // 4-float stores in memory order, each one's 4th float is overwritten by the next
+        // store and the last one by the texture coordinates. Everything was loaded first,
+        // so `src` and `dst` may still be the same array.
+        Vertex& t = dst[i];
+        _mm_storeu_ps(reinterpret_cast<float*>(&t.position), _mm256_castps256_ps128(r0));
+        _mm_storeu_ps(reinterpret_cast<float*>(&t.normal), _mm256_extractf128_ps(r0, 1));
+        _mm_storeu_ps(reinterpret_cast<float*>(&t.tangent), _mm256_castps256_ps128(r1));
+        _mm_storeu_ps(reinterpret_cast<float*>(&t.bitangent), _mm256_extractf128_ps(r1, 1));
+        t.texCoords = texCoords;
+    }
+}
+
+#endif
+
+bool transformKernelSupported(TransformKernel kernel) {
+    switch (kernel) {
+    case ScalarKernel:
+        return true;
+#ifdef VERTEX_USE_SSE2
+    case Sse2Kernel:
+        return true;
+#endif
+#ifdef VERTEX_USE_AVX
+    case AvxKernel: {
+        static const bool hasAvx = cpuHasAvx();
+        return hasAvx;
+    }
+#endif
+    default:
+        return false;
+    }
+}
+
+void transformVertices(TransformKernel kernel, const QMatrix4x4 & mat, const Vertex * src, Vertex * dst, int count) {
+#ifdef VERTEX_USE_AVX
+    if (kernel == AvxKernel && transformKernelSupported(AvxKernel)) {
+        transformVerticesAvx(mat, src, dst, count);
+        return;
+    }
+#endif
+#ifdef VERTEX_USE_SSE2
+    if (kernel != ScalarKernel) {
+        transformVerticesSse2(mat, src, dst, count);
+        return;
+    }
+#endif
+    transformVerticesScalar(mat, src, dst, count);
+}
+
+void transformVertices(const QMatrix4x4 & mat, const Vertex * src, Vertex * dst, int count) {
+    transformVertices(AvxKernel, mat, src, dst, count);
+}
+
+void orthogonalizeTangents(Vertex * vertices, int count) {
+    for (int i = 0; i < count; i++) {
+        Vertex& vertex = vertices[i];
+
+        // Gram-Schmidt process, re-orthogonalize the TBN vectors
+        vertex.tangent -= QVector3D::dotProduct(vertex.tangent, vertex.normal) * vertex.normal;
+        vertex.tangent.normalize();
+
+        // Deal with mirrored texture coordinates
+        if (QVector3D::dotProduct(QVector3D::crossProduct(vertex.tangent, vertex.normal), vertex.bitangent) < 0.0f)
+            vertex.tangent = -vertex.tangent;
+    }
+}
+
+QDataStream &operator<<(QDataStream &out, const Vertex& vertex) {
+    out << vertex.position;
+    out << vertex.normal;
+    out << vertex.tangent;
+    out << vertex.bitangent;
+    out << vertex.texCoords;
+    return out;
+}
+
+QDataStream &operator>>(QDataStream &in, Vertex& vertex) {
+    in >> vertex.position;
+    in >> vertex.normal;
+    in >> vertex.tangent;
+    in >> vertex.bitangent;
+    in >> vertex.texCoords;
+    return in;
+}
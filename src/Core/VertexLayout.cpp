@@ -0,0 +1,182 @@
+#include <VertexLayout.h>
+
+static inline float signNotZero(float v) {
+    return v >= 0.0f ? 1.0f : -1.0f;
+}
+
+static inline qint16 toSnorm16(float v) {
+    return qint16(qRound(qBound(-1.0f, v, 1.0f) * 32767.0f));
+}
+
+static inline qint8 toSnorm8(float v) {
+    return qint8(qRound(qBound(-1.0f, v, 1.0f) * 127.0f));
+}
+
+static inline quint16 toUnorm16(float v) {
+    return quint16(qRound(qBound(0.0f, v, 1.0f) * 65535.0f));
+}
+
+static inline quint16 toHalf(float v) {
+    quint32 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    quint32 sign = (bits >> 16) & 0x8000;
+    qint32 exponent = qint32((bits >> 23) & 0xFF) - 127 + 15;
+    quint32 mantissa = bits & 0x7FFFFF;
+    if (exponent <= 0) { // Subnormal or zero
+        if (exponent < -10) return quint16(sign);
+        mantissa |= 0x800000;
+        return quint16(sign | (mantissa >> (14 - exponent)));
+    }
+    if (exponent >= 31) // Overflow, Inf and NaN
+        return quint16(sign | 0x7C00);
+    return quint16(sign | (quint32(exponent) << 10) | (mantissa >> 13));
+}
+
+// Octahedral mapping of a unit vector onto [-1, 1]^2
+static inline QVector2D octEncode(QVector3D n) {
+    float l1 = qAbs(n.x()) + qAbs(n.y()) + qAbs(n.z());
+    if (l1 < eps) return QVector2D(0, 0);
+    n /= l1;
+    if (n.z() >= 0.0f)
+        return QVector2D(n.x(), n.y());
+    return QVector2D((1.0f - qAbs(n.y())) * signNotZero(n.x()),
+                     (1.0f - qAbs(n.x())) * signNotZero(n.y()));
+}
+
+VertexLayout::VertexLayout(int options) {
+    m_options = options;
+    m_stride = 0;
+    m_positionOffset = QVector3D(0, 0, 0);
+    m_positionScale = QVector3D(1, 1, 1);
+
+    if (m_options & QuantizedPositions)
+        addAttribute(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, 8); // padded to 4 components
+    else
+        addAttribute(0, 3, GL_FLOAT, GL_FALSE, 12);
+
+    if (m_options & OctahedralNormals)
+        addAttribute(1, 2, GL_SHORT, GL_TRUE, 4);
+    else
+        addAttribute(1, 3, GL_FLOAT, GL_FALSE, 12);
+
+    if (hasTangents()) {
+        if (m_options & PackedTangents)
+            addAttribute(2, 4, GL_BYTE, GL_TRUE, 4);
+        else {
+            addAttribute(2, 3, GL_FLOAT, GL_FALSE, 12);
+            addAttribute(3, 3, GL_FLOAT, GL_FALSE, 12);
+        }
+    }
+
+    if (m_options & HalfFloatTexCoords)
+        addAttribute(4, 2, GL_HALF_FLOAT, GL_FALSE, 4);
+    else
+        addAttribute(4, 2, GL_FLOAT, GL_FALSE, 8);
+}
+
+int VertexLayout::options() const {
+    return m_options;
+}
+
+int VertexLayout::stride() const {
+    return m_stride;
+}
+
+bool VertexLayout::hasTangents() const {
+    return !(m_options & NoTangents);
+}
+
+const QVector<VertexLayout::Attribute>& VertexLayout::attributes() const {
+    return m_attributes;
+}
+
+QVector3D VertexLayout::positionOffset() const {
+    return m_positionOffset;
+}
+
+QVector3D VertexLayout::positionScale() const {
+    return m_positionScale;
+}
+
+void VertexLayout::setPositionRange(QVector3D minPosition, QVector3D maxPosition) {
+    if (!(m_options & QuantizedPositions)) return;
+    QVector3D extent = maxPosition - minPosition;
+    for (int i = 0; i < 3; i++)
+        if (extent[i] < eps) extent[i] = eps;
+    m_positionOffset = minPosition;
+    m_positionScale = extent;
+}
+
+QByteArray VertexLayout::pack(const QVector<Vertex>& vertices) const {
+    QByteArray bytes(m_stride * vertices.size(), Qt::Uninitialized);
+    if (vertices.size())
+        pack(vertices.constData(), vertices.size(), bytes.data());
+    return bytes;
+}
+
+QByteArray VertexLayout::pack(const VertexAttributes & attributes) const {
+    QByteArray bytes(m_stride * attributes.size(), Qt::Uninitialized);
+    if (attributes.size())
+        pack(attributes, 0, attributes.size(), bytes.data());
+    return bytes;
+}
+
+void VertexLayout::pack(const Vertex * vertices, int count, char * dst) const {
+    pack(VertexAttributes(vertices, count), 0, count, dst);
+}
+
+void VertexLayout::pack(const VertexAttributes & attributes, int offset, int count, char * dst) const {
+    for (int i = offset; i < offset + count; i++, dst += m_stride) {
+        const QVector3D& position = attributes.positions[i];
+        const QVector3D& normal = attributes.normals[i];
+        const QVector2D& texCoords = attributes.texCoords[i];
+        char* p = dst;
+
+        if (m_options & QuantizedPositions) {
+            QVector3D t = (position - m_positionOffset) / m_positionScale;
+            quint16 q[4] = { toUnorm16(t[0]), toUnorm16(t[1]), toUnorm16(t[2]), 0 };
+            memcpy(p, q, 8); p += 8;
+        } else {
+            float f[3] = { position[0], position[1], position[2] };
+            memcpy(p, f, 12); p += 12;
+        }
+
+        if (m_options & OctahedralNormals) {
+            QVector2D e = octEncode(normal);
+            qint16 q[2] = { toSnorm16(e[0]), toSnorm16(e[1]) };
+            memcpy(p, q, 4); p += 4;
+        } else {
+            float f[3] = { normal[0], normal[1], normal[2] };
+            memcpy(p, f, 12); p += 12;
+        }
+
+        if (hasTangents()) {
+            const QVector3D& tangent = attributes.tangents[i];
+            const QVector3D& bitangent = attributes.bitangents[i];
+            if (m_options & PackedTangents) {
+                // The bitangent is rebuilt in the shader as cross(T, N) * w
+                QVector3D t = tangent.normalized();
+                float w = QVector3D::dotProduct(QVector3D::crossProduct(tangent, normal), bitangent) < 0.0f ? -1.0f : 1.0f;
+                qint8 q[4] = { toSnorm8(t[0]), toSnorm8(t[1]), toSnorm8(t[2]), toSnorm8(w) };
+                memcpy(p, q, 4); p += 4;
+            } else {
+                float f[6] = { tangent[0], tangent[1], tangent[2],
+                               bitangent[0], bitangent[1], bitangent[2] };
+                memcpy(p, f, 24); p += 24;
+            }
+        }
+
+        if (m_options & HalfFloatTexCoords) {
+            quint16 h[2] = { toHalf(texCoords[0]), toHalf(texCoords[1]) };
+            memcpy(p, h, 4);
+        } else {
+            float f[2] = { texCoords[0], texCoords[1] };
+            memcpy(p, f, 8);
+        }
+    }
+}
+
+void VertexLayout::addAttribute(GLuint location, GLint size, GLenum type, GLboolean normalized, int bytes) {
+    m_attributes.push_back({ location, size, type, normalized, m_stride });
+    m_stride += bytes;
+}
@@ -0,0 +1,79 @@
+#include <VertexStreams.h>
+
+VertexAttributes::VertexAttributes() {}
+
+VertexAttributes::VertexAttributes(const Vertex * vertices, int count):
+    positions(&vertices->position, sizeof(Vertex), count),
+    normals(&vertices->normal, sizeof(Vertex), count),
+    tangents(&vertices->tangent, sizeof(Vertex), count),
+    bitangents(&vertices->bitangent, sizeof(Vertex), count),
+    texCoords(&vertices->texCoords, sizeof(Vertex), count) {}
+
+int VertexAttributes::size() const {
+    return positions.size();
+}
+
+Vertex VertexAttributes::vertex(int i) const {
+    return Vertex(positions[i], normals[i], tangents[i], bitangents[i], texCoords[i]);
+}
+
+void VertexAttributes::gather(int offset, int count, Vertex * dst) const {
+    for (int i = 0; i < count; i++) {
+        dst[i].position = positions[offset + i];
+        dst[i].normal = normals[offset + i];
+        dst[i].tangent = tangents[offset + i];
+        dst[i].bitangent = bitangents[offset + i];
+        dst[i].texCoords = texCoords[offset + i];
+    }
+}
+
+VertexStreams::VertexStreams() {}
+
+VertexStreams::VertexStreams(const Vertex * vertices, int count):
+    positions(count), normals(count), tangents(count), bitangents(count), texCoords(count) {
+    scatter(0, vertices, count);
+}
+
+int VertexStreams::size() const {
+    return positions.size();
+}
+
+void VertexStreams::clear() {
+    positions.clear();
+    normals.clear();
+    tangents.clear();
+    bitangents.clear();
+    texCoords.clear();
+}
+
+VertexAttributes VertexStreams::attributes() const {
+    VertexAttributes attributes;
+    attributes.positions = AttributeView<QVector3D>(positions.constData(), sizeof(QVector3D), positions.size());
+    attributes.normals = AttributeView<QVector3D>(normals.constData(), sizeof(QVector3D), normals.size());
+    attributes.tangents = AttributeView<QVector3D>(tangents.constData(), sizeof(QVector3D), tangents.size());
+    attributes.bitangents = AttributeView<QVector3D>(bitangents.constData(), sizeof(QVector3D), bitangents.size());
+    attributes.texCoords = AttributeView<QVector2D>(texCoords.constData(), sizeof(QVector2D), texCoords.size());
+    return attributes;
+}
+
+void VertexStreams::scatter(int offset, const Vertex * vertices, int count) {
+    QVector3D* p = positions.data() + offset;
+    QVector3D* n = normals.data() + offset;
+    QVector3D* t = tangents.data() + offset;
+    QVector3D* b = bitangents.data() + offset;
+    QVector2D* uv = texCoords.data() + offset;
+    for (int i = 0; i < count; i++) {
+        p[i] = vertices[i].position;
+        n[i] = vertices[i].normal;
+        t[i] = vertices[i].tangent;
+        b[i] = vertices[i].bitangent;
+        uv[i] = vertices[i].texCoords;
+    }
+}
+
+QVector<Vertex> VertexStreams::interleave() const {
+    QVector<Vertex> vertices(size());
+    if (size())
+        attributes().gather(0, size(), vertices.data());
+    return vertices;
+}
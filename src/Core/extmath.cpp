@@ -1,63 +1,195 @@
-#include <extmath.h>
-#include <Common.h>
-
-bool isEqual(float a, float b) {
-    return qAbs(a - b) < eps;
-}
-
-bool isEqual(QVector3D a, QVector3D b) {
-    return isEqual(a[0], b[0]) && isEqual(a[1], b[1]) && isEqual(a[2], b[2]);
-}
-
-bool isnan(QVector2D a) {
-    return qIsNaN(a[0]) || qIsNaN(a[1]);
-}
-
-bool isnan(QVector3D a) {
-    return qIsNaN(a[0]) || qIsNaN(a[1]) || qIsNaN(a[2]);
-}
-
-bool isnan(QVector4D a) {
-    return qIsNaN(a[0]) || qIsNaN(a[1]) || qIsNaN(a[2]) || qIsNaN(a[3]);
-}
-
-Line operator*(const QMatrix4x4 &m, const Line &l) {
-    QVector3D st = l.st, ed = l.st + l.dir;
-    st = m * st;
-    ed = m * ed;
-    return { st, ed - st };
-}
-
-QVector3D getIntersectionOfLinePlane(Line l, Plane p) {
-    float t = QVector3D::dotProduct(p.n, p.v - l.st) / QVector3D::dotProduct(p.n, l.dir);
-    if (isnan(t) && log_level >= LOG_LEVEL_WARNING)
-        dout << "Warning: NaN detected";
-    return l.st + l.dir * t;
-}
-
-QVector3D getClosestPointOfLines(Line l1, Line l2) {
-    l1.dir.normalize();
-    l2.dir.normalize();
-    QVector3D n = QVector3D::crossProduct(l1.dir, l2.dir);
-    if (isnan(n) && log_level >= LOG_LEVEL_WARNING)
-        dout << "Warning: NaN detected";
-    return getIntersectionOfLinePlane({ l1.st, l1.dir },
-                                      { l2.st, QVector3D::crossProduct(n, l2.dir) });
-}
-
-Line screenPosToWorldRay(QVector2D cursorPos, QVector2D windowSize, QMatrix4x4 proj, QMatrix4x4 view) {
-    cursorPos.setY(windowSize.y() - cursorPos.y());
-    QMatrix4x4 inv = (proj * view).inverted();
-    QVector4D st((cursorPos / windowSize - QVector2D(0.5, 0.5)) * 2.0f, -1.0, 1.0f);
-    QVector4D ed((cursorPos / windowSize - QVector2D(0.5, 0.5)) * 2.0f, 0.0, 1.0f);
-    st = inv * st; st /= st.w();
-    ed = inv * ed; ed /= ed.w();
-    if (isnan(st) && log_level >= LOG_LEVEL_WARNING)
-        dout << "Warning: NaN detected";
-    if (isnan(ed) && log_level >= LOG_LEVEL_WARNING)
-        dout << "Warning: NaN detected";
-    QVector3D dir = (ed - st).toVector3D();
-    if (dir.isNull() && log_level >= LOG_LEVEL_WARNING)
-        dout << "Warning: dir is null";
-    return Line { st.toVector3D(), dir.normalized() };
-}
+#include <extmath.h>
+#include <Common.h>
+
+bool isEqual(float a, float b) {
+    return qAbs(a - b) < eps;
+}
+
+bool isEqual(QVector3D a, QVector3D b) {
+    return isEqual(a[0], b[0]) && isEqual(a[1], b[1]) && isEqual(a[2], b[2]);
+}
+
+bool isnan(QVector2D a) {
+    return qIsNaN(a[0]) || qIsNaN(a[1]);
+}
+
+bool isnan(QVector3D a) {
+    return qIsNaN(a[0]) || qIsNaN(a[1]) || qIsNaN(a[2]);
+}
+
+bool isnan(QVector4D a) {
+    return qIsNaN(a[0]) || qIsNaN(a[1]) || qIsNaN(a[2]) || qIsNaN(a[3]);
+}
+
+AABB::AABB(): minimum(FLT_MAX, FLT_MAX, FLT_MAX), maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX) {}
+
+AABB::AABB(QVector3D _minimum, QVector3D _maximum): minimum(_minimum), maximum(_maximum) {}
+
+bool AABB::isEmpty() const {
+    return minimum[0] > maximum[0] || minimum[1] > maximum[1] || minimum[2] > maximum[2];
+}
+
+QVector3D AABB::center() const {
+    return (minimum + maximum) / 2;
+}
+
+QVector3D AABB::size() const {
+    return isEmpty() ? QVector3D(0, 0, 0) : maximum - minimum;
+}
+
+void AABB::merge(QVector3D p) {
+    for (int i = 0; i < 3; i++) {
+        minimum[i] = qMin(minimum[i], p[i]);
+        maximum[i] = qMax(maximum[i], p[i]);
+    }
+}
+
+void AABB::merge(const AABB & b) {
+    if (b.isEmpty()) return;
+    merge(b.minimum);
+    merge(b.maximum);
+}
+
+Sphere::Sphere(): center(0, 0, 0), radius(-1.0f) {}
+
+Sphere::Sphere(QVector3D _center, float _radius): center(_center), radius(_radius) {}
+
+bool Sphere::isEmpty() const {
+    return radius < 0.0f;
+}
+
+void Sphere::merge(const Sphere & s) {
+    if (s.isEmpty()) return;
+    if (isEmpty()) {
+        *this = s;
+        return;
+    }
+    QVector3D d = s.center - center;
+    float dist = d.length();
+    if (dist + s.radius <= radius) return; // s is inside this sphere
+    if (dist + radius <= s.radius) {       // this sphere is inside s
+        *this = s;
+        return;
+    }
+    float newRadius = (dist + radius + s.radius) / 2;
+    center += d * ((newRadius - radius) / dist);
+    radius = newRadius;
+}
+
+Frustum::Frustum() {
+    for (int i = 0; i < 6; i++)
+        planes[i] = QVector4D(0, 0, 0, 0);
+}
+
+Frustum::Frustum(const QMatrix4x4 & m) {
+    QVector4D r0 = m.row(0), r1 = m.row(1), r2 = m.row(2), r3 = m.row(3);
+    planes[0] = r3 + r0; // left
+    planes[1] = r3 - r0; // right
+    planes[2] = r3 + r1; // bottom
+    planes[3] = r3 - r1; // top
+    planes[4] = r3 + r2; // near
+    planes[5] = r3 - r2; // far
+    for (int i = 0; i < 6; i++) {
+        float length = planes[i].toVector3D().length();
+        if (length > 0.0f) planes[i] /= length;
+    }
+}
+
+bool Frustum::intersects(const Sphere & s) const {
+    if (s.isEmpty()) return false;
+    for (int i = 0; i < 6; i++)
+        if (QVector3D::dotProduct(planes[i].toVector3D(), s.center) + planes[i].w() < -s.radius)
+            return false;
+    return true;
+}
+
+bool Frustum::intersects(const AABB & b) const {
+    if (b.isEmpty()) return false;
+    for (int i = 0; i < 6; i++) {
+        // The corner furthest along the plane normal
+        QVector3D p(planes[i].x() >= 0 ? b.maximum.x() : b.minimum.x(),
+                    planes[i].y() >= 0 ? b.maximum.y() : b.minimum.y(),
+                    planes[i].z() >= 0 ? b.maximum.z() : b.minimum.z());
+        if (QVector3D::dotProduct(planes[i].toVector3D(), p) + planes[i].w() < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+Line operator*(const QMatrix4x4 &m, const Line &l) {
+    QVector3D st = l.st, ed = l.st + l.dir;
+    st = m * st;
+    ed = m * ed;
+    return { st, ed - st };
+}
+
+AABB operator*(const QMatrix4x4 &m, const AABB &b) {
+    if (b.isEmpty()) return b;
+    // Arvo's method: transform the center and accumulate the absolute extents
+    QVector3D c = m * b.center(), e = b.size() / 2, r;
+    for (int i = 0; i < 3; i++)
+        r[i] = qAbs(m(i, 0)) * e[0] + qAbs(m(i, 1)) * e[1] + qAbs(m(i, 2)) * e[2];
+    return AABB(c - r, c + r);
+}
+
+Sphere operator*(const QMatrix4x4 &m, const Sphere &s) {
+    if (s.isEmpty()) return s;
+    float scale = qMax(qMax(m.column(0).toVector3D().length(),
+                            m.column(1).toVector3D().length()),
+                       m.column(2).toVector3D().length());
+    return Sphere(m * s.center, s.radius * scale);
+}
+
+float measureScale(const QMatrix4x4 &m, int dimension) {
+    if (dimension == 0) return 1.0f;
+    float det = m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1))
+              - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0))
+              + m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+    return qPow(qAbs(det), dimension / 3.0f);
+}
+
+bool isSimilarity(const QMatrix4x4 &m) {
+    QVector3D c0 = m.column(0).toVector3D();
+    QVector3D c1 = m.column(1).toVector3D();
+    QVector3D c2 = m.column(2).toVector3D();
+    float l0 = c0.lengthSquared(), l1 = c1.lengthSquared(), l2 = c2.lengthSquared();
+    float tolerance = 1e-4f * qMax(l0, qMax(l1, l2));
+    return qAbs(l0 - l1) <= tolerance && qAbs(l0 - l2) <= tolerance &&
+           qAbs(QVector3D::dotProduct(c0, c1)) <= tolerance &&
+           qAbs(QVector3D::dotProduct(c0, c2)) <= tolerance &&
+           qAbs(QVector3D::dotProduct(c1, c2)) <= tolerance;
+}
+
+QVector3D getIntersectionOfLinePlane(Line l, Plane p) {
+    float t = QVector3D::dotProduct(p.n, p.v - l.st) / QVector3D::dotProduct(p.n, l.dir);
+    if (isnan(t) && log_level >= LOG_LEVEL_WARNING)
+        dout << "Warning: NaN detected";
+    return l.st + l.dir * t;
+}
+
+QVector3D getClosestPointOfLines(Line l1, Line l2) {
+    l1.dir.normalize();
+    l2.dir.normalize();
+    QVector3D n = QVector3D::crossProduct(l1.dir, l2.dir);
+    if (isnan(n) && log_level >= LOG_LEVEL_WARNING)
+        dout << "Warning: NaN detected";
+    return getIntersectionOfLinePlane({ l1.st, l1.dir },
+                                      { l2.st, QVector3D::crossProduct(n, l2.dir) });
+}
+
+Line screenPosToWorldRay(QVector2D cursorPos, QVector2D windowSize, QMatrix4x4 proj, QMatrix4x4 view) {
+    cursorPos.setY(windowSize.y() - cursorPos.y());
+    QMatrix4x4 inv = (proj * view).inverted();
+    QVector4D st((cursorPos / windowSize - QVector2D(0.5, 0.5)) * 2.0f, -1.0, 1.0f);
+    QVector4D ed((cursorPos / windowSize - QVector2D(0.5, 0.5)) * 2.0f, 0.0, 1.0f);
+    st = inv * st; st /= st.w();
+    ed = inv * ed; ed /= ed.w();
+    if (isnan(st) && log_level >= LOG_LEVEL_WARNING)
+        dout << "Warning: NaN detected";
+    if (isnan(ed) && log_level >= LOG_LEVEL_WARNING)
+        dout << "Warning: NaN detected";
+    QVector3D dir = (ed - st).toVector3D();
+    if (dir.isNull() && log_level >= LOG_LEVEL_WARNING)
+        dout << "Warning: dir is null";
+    return Line { st.toVector3D(), dir.normalized() };
+}
@@ -0,0 +1,182 @@
+#include <OpenGLGeometry.h>
+
+QHash<QPair<quint64, int>, OpenGLGeometry*> OpenGLGeometry::m_cache;
+
+OpenGLGeometry * OpenGLGeometry::acquire(Mesh * mesh, int layoutOptions) {
+    QPair<quint64, int> key(mesh->geometryId(), layoutOptions);
+    OpenGLGeometry* geometry = m_cache.value(key, 0);
+    if (geometry == 0) {
+        geometry = new OpenGLGeometry(mesh, layoutOptions);
+        m_cache[key] = geometry;
+    } else if (log_level >= LOG_LEVEL_INFO)
+        dout << "Mesh" << mesh->objectName() << "shares the GPU buffers of an identical geometry";
+    geometry->m_refCount++;
+    return geometry;
+}
+
+void OpenGLGeometry::drop() {
+    if (--m_refCount > 0) return;
+    m_cache.remove(qMakePair(m_geometryId, m_layout.options()));
+    delete this;
+}
+
+OpenGLGeometry::OpenGLGeometry(Mesh * mesh, int layoutOptions) {
+    VertexAttributes attributes = mesh->attributes();
+
+    m_geometryId = mesh->geometryId();
+    m_refCount = 0;
+    m_layout = VertexLayout(layoutOptions);
+    m_positionRange = mesh->localBoundingBox();
+    if ((m_layout.options() & VertexLayout::QuantizedPositions) && !m_positionRange.isEmpty())
+        m_layout.setPositionRange(m_positionRange.minimum, m_positionRange.maximum);
+    m_vertexCount = attributes.size();
+    m_indexCount = mesh->indices().size();
+
+    m_vao = new QOpenGLVertexArrayObject;
+    m_vao->create();
+    m_vao->bind();
+    m_vbo = new QOpenGLBuffer(QOpenGLBuffer::VertexBuffer);
+    m_vbo->create();
+    m_vbo->bind();
+    if (attributes.size()) {
+        QByteArray packedVertices = m_layout.pack(attributes);
+        m_vbo->allocate(packedVertices.constData(), packedVertices.size());
+    }
+    m_ebo = new QOpenGLBuffer(QOpenGLBuffer::IndexBuffer);
+    m_ebo->create();
+    m_ebo->bind();
+    m_indexType = attributes.size() <= 65536 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT; // 16-bit indices are enough
+    uploadIndices(mesh);
+
+    QOpenGLFunctions_3_3_Core * glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
+    for (int i = 0; i < m_layout.attributes().size(); i++) {
+        const VertexLayout::Attribute& attribute = m_layout.attributes()[i];
+        glFuncs->glEnableVertexAttribArray(attribute.location);
+        glFuncs->glVertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.normalized,
+                                       m_layout.stride(), (void*) intptr_t(attribute.offset));
+    }
+
+    m_vao->release();
+}
+
+OpenGLGeometry::~OpenGLGeometry() {
+    delete m_vao;
+    delete m_vbo;
+    delete m_ebo;
+}
+
+quint64 OpenGLGeometry::geometryId() const {
+    return m_geometryId;
+}
+
+int OpenGLGeometry::refCount() const {
+    return m_refCount;
+}
+
+const VertexLayout & OpenGLGeometry::layout() const {
+    return m_layout;
+}
+
+const AABB & OpenGLGeometry::positionRange() const {
+    return m_positionRange;
+}
+
+GLenum OpenGLGeometry::indexType() const {
+    return m_indexType;
+}
+
+int OpenGLGeometry::indexSize() const {
+    return m_indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+}
+
+int OpenGLGeometry::vertexCount() const {
+    return m_vertexCount;
+}
+
+int OpenGLGeometry::indexCount() const {
+    return m_indexCount;
+}
+
+int OpenGLGeometry::lodCount() const {
+    return m_lodCounts.size();
+}
+
+int OpenGLGeometry::lodOffset(int level) const {
+    return m_lodOffsets[level];
+}
+
+int OpenGLGeometry::lodIndexCount(int level) const {
+    return m_lodCounts[level];
+}
+
+void OpenGLGeometry::bind() {
+    m_vao->bind();
+}
+
+void OpenGLGeometry::release() {
+    m_vao->release();
+}
+
+bool OpenGLGeometry::update(Mesh * mesh, int dirtyBegin, int dirtyEnd, bool indicesDirty) {
+    QPair<quint64, int> key(mesh->geometryId(), m_layout.options());
+    if (m_cache.value(key, this) != this) return false;
+
+    VertexAttributes attributes = mesh->attributes();
+
+    m_vao->bind();
+    if (dirtyEnd > dirtyBegin) {
+        m_vbo->bind();
+        if (dirtyBegin == 0 && dirtyEnd == m_vertexCount) {
+            // Orphan the old storage rather than stall on a draw still using it
+            QByteArray packedVertices = m_layout.pack(attributes);
+            m_vbo->allocate(packedVertices.constData(), packedVertices.size());
+        } else {
+            int count = dirtyEnd - dirtyBegin;
+            QByteArray packedVertices(m_layout.stride() * count, Qt::Uninitialized);
+            m_layout.pack(attributes, dirtyBegin, count, packedVertices.data());
+            m_vbo->write(m_layout.stride() * dirtyBegin, packedVertices.constData(), packedVertices.size());
+        }
+    }
+    if (indicesDirty) {
+        m_ebo->bind();
+        uploadIndices(mesh);
+    }
+    m_vao->release();
+
+    m_cache.remove(qMakePair(m_geometryId, m_layout.options()));
+    m_geometryId = mesh->geometryId();
+    m_cache[key] = this;
+    return true;
+}
+
+// All levels of detail are packed one after another into the same index buffer
+void OpenGLGeometry::uploadIndices(Mesh * mesh) {
+    m_indexCount = mesh->indices().size();
+    m_lodOffsets.resize(mesh->lodCount());
+    m_lodCounts.resize(mesh->lodCount());
+    int totalCount = 0;
+    for (int level = 0; level < mesh->lodCount(); level++) {
+        m_lodOffsets[level] = totalCount;
+        m_lodCounts[level] = mesh->lodIndices(level).size();
+        totalCount += m_lodCounts[level];
+    }
+    if (totalCount == 0) return;
+
+    if (m_indexType == GL_UNSIGNED_SHORT) {
+        QVector<uint16_t> shortIndices(totalCount);
+        for (int level = 0; level < mesh->lodCount(); level++) {
+            const QVector<uint32_t>& indices = mesh->lodIndices(level);
+            for (int i = 0; i < indices.size(); i++)
+                shortIndices[m_lodOffsets[level] + i] = uint16_t(indices[i]);
+        }
+        m_ebo->allocate(&shortIndices[0], int(sizeof(uint16_t) * shortIndices.size()));
+    } else if (mesh->lodCount() == 1) {
+        m_ebo->allocate(mesh->indices().constData(), int(sizeof(uint32_t) * totalCount));
+    } else {
+        QVector<uint32_t> allIndices;
+        allIndices.reserve(totalCount);
+        for (int level = 0; level < mesh->lodCount(); level++)
+            allIndices += mesh->lodIndices(level);
+        m_ebo->allocate(&allIndices[0], int(sizeof(uint32_t) * allIndices.size()));
+    }
+}
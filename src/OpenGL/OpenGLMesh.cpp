@@ -1,164 +1,366 @@
-#include <OpenGLMesh.h>
-#include <OpenGLMaterial.h>
-
-struct ShaderModelInfo {
-    float modelMat[16];   // 64          // 0
-    float normalMat[16];  // 64          // 64
-    int sizeFixed;        // 4           // 128
-    int selected;         // 4           // 132
-    int highlighted;      // 4           // 136
-    uint pickingID;        // 4           // 140
-};
-
-static ShaderModelInfo shaderModelInfo;
-
-OpenGLUniformBufferObject *OpenGLMesh::m_modelInfo = 0;
-
-OpenGLMesh::OpenGLMesh(Mesh * mesh, QObject* parent): QObject(0) {
-    m_host = mesh;
-    m_sizeFixed = false;
-    m_pickingID = 0;
-    m_vao = 0;
-    m_vbo = 0;
-    m_ebo = 0;
-    if (m_host->material())
-        m_openGLMaterial = new OpenGLMaterial(m_host->material());
-    else
-        m_openGLMaterial = 0;
-
-    connect(m_host, SIGNAL(materialChanged(Material*)), this, SLOT(materialChanged(Material*)));
-    connect(m_host, SIGNAL(geometryChanged(QVector<Vertex>, QVector<uint32_t>)), this, SLOT(geometryChanged(QVector<Vertex>, QVector<uint32_t>)));
-    connect(m_host, SIGNAL(destroyed(QObject*)), this, SLOT(hostDestroyed(QObject*)));
-
-    setParent(parent);
-}
-
-OpenGLMesh::~OpenGLMesh() {
-    this->destroy();
-}
-
-Mesh * OpenGLMesh::host() const {
-    return m_host;
-}
-
-void OpenGLMesh::create() {
-    this->destroy();
-
-    m_vao = new QOpenGLVertexArrayObject;
-    m_vao->create();
-    m_vao->bind();
-    m_vbo = new QOpenGLBuffer(QOpenGLBuffer::VertexBuffer);
-    m_vbo->create();
-    m_vbo->bind();
-    if (m_host->vertices().size())
-        m_vbo->allocate(&m_host->vertices()[0], int(sizeof(Vertex) * m_host->vertices().size()));
-    m_ebo = new QOpenGLBuffer(QOpenGLBuffer::IndexBuffer);
-    m_ebo->create();
-    m_ebo->bind();
-    if (m_host->indices().size())
-        m_ebo->allocate(&m_host->indices()[0], int(sizeof(uint32_t) * m_host->indices().size()));
-
-    glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
-    glFuncs->glEnableVertexAttribArray(0);
-    glFuncs->glEnableVertexAttribArray(1);
-    glFuncs->glEnableVertexAttribArray(2);
-    glFuncs->glEnableVertexAttribArray(3);
-    glFuncs->glEnableVertexAttribArray(4);
-    glFuncs->glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*) offsetof(Vertex, position));
-    glFuncs->glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*) offsetof(Vertex, normal));
-    glFuncs->glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*) offsetof(Vertex, tangent));
-    glFuncs->glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*) offsetof(Vertex, bitangent));
-    glFuncs->glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*) offsetof(Vertex, texCoords));
-
-    m_vao->release();
-}
-
-void OpenGLMesh::commit() {
-    QMatrix4x4 modelMat = m_host->globalModelMatrix();
-
-    memcpy(shaderModelInfo.modelMat, modelMat.constData(), 64);
-    memcpy(shaderModelInfo.normalMat, QMatrix4x4(modelMat.normalMatrix()).constData(), 64);
-    shaderModelInfo.sizeFixed = this->m_sizeFixed;
-    shaderModelInfo.selected = m_host->selected();
-    shaderModelInfo.highlighted = m_host->highlighted();
-    shaderModelInfo.pickingID = this->m_pickingID;
-
-    if (m_modelInfo == 0) {
-        m_modelInfo = new OpenGLUniformBufferObject;
-        m_modelInfo->create();
-        m_modelInfo->bind();
-        m_modelInfo->allocate(MODEL_INFO_BINDING_POINT, NULL, sizeof(ShaderModelInfo));
-        m_modelInfo->release();
-    }
-    m_modelInfo->bind();
-    m_modelInfo->write(0, &shaderModelInfo, sizeof(ShaderModelInfo));
-    m_modelInfo->release();
-}
-
-void OpenGLMesh::render(bool pickingPass) {
-    if (!m_host->visible()) return;
-    if (m_vao == 0 || m_vbo == 0 || m_ebo == 0) create();
-
-    commit();
-
-    if (!pickingPass && m_host->wireFrameMode())
-        glFuncs->glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    else if (m_openGLMaterial)
-        m_openGLMaterial->bind();
-
-    m_vao->bind();
-
-    if (m_host->meshType() == Mesh::Triangle)
-        glFuncs->glDrawElements(GL_TRIANGLES, (GLsizei) m_host->indices().size(), GL_UNSIGNED_INT, 0);
-    else if (m_host->meshType() == Mesh::Line)
-        glFuncs->glDrawElements(GL_LINES, (GLsizei) m_host->indices().size(), GL_UNSIGNED_INT, 0);
-    else
-        glFuncs->glDrawElements(GL_POINTS, (GLsizei) m_host->indices().size(), GL_UNSIGNED_INT, 0);
-
-    m_vao->release();
-
-    if (!pickingPass && m_host->wireFrameMode())
-        glFuncs->glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-    else if (m_openGLMaterial)
-        m_openGLMaterial->release();
-}
-
-void OpenGLMesh::destroy() {
-    if (m_vao) delete m_vao;
-    if (m_vbo) delete m_vbo;
-    if (m_ebo) delete m_ebo;
-    m_vao = 0;
-    m_vbo = 0;
-    m_ebo = 0;
-}
-
-void OpenGLMesh::setSizeFixed(bool sizeFixed) {
-    m_sizeFixed = sizeFixed;
-}
-
-void OpenGLMesh::setPickingID(uint id) {
-    m_pickingID = id;
-}
-
-void OpenGLMesh::childEvent(QChildEvent * e) {
-    if (e->removed()) {
-        if (e->child() == m_openGLMaterial)
-            m_openGLMaterial = 0;
-    }
-}
-
-void OpenGLMesh::materialChanged(Material * material) {
-    if (material == 0)
-        m_openGLMaterial = 0;
-    else
-        m_openGLMaterial = new OpenGLMaterial(material);
-}
-
-void OpenGLMesh::geometryChanged(const QVector<Vertex>&, const QVector<uint32_t>&) {
-    this->create();
-}
-
-void OpenGLMesh::hostDestroyed(QObject *) {
-    // Commit suicide
-    delete this;
-}
+#include <OpenGLMesh.h>
+#include <OpenGLMaterial.h>
+
+struct ShaderModelInfo {
+    float modelMat[16];       // 64          // 0
+    float normalMat[16];      // 64          // 64
+    int sizeFixed;            // 4           // 128
+    int selected;             // 4           // 132
+    int highlighted;          // 4           // 136
+    uint pickingID;           // 4           // 140
+    int vertexLayout;         // 4           // 144
+    int instanced;            // 4           // 148
+    int padding[2];           // 8           // 152
+    QVector4D positionOffset; // 16          // 160
+    QVector4D positionScale;  // 16          // 176
+};
+
+struct ShaderInstanceInfo {
+    float modelMat[16];       // 64          // 0    location 5-8
+    float normalMat[9];       // 36          // 64   location 9-11
+    uint pickingID;           // 4           // 100  location 12
+    int flags;                // 4           // 104
+};
+
+static ShaderModelInfo shaderModelInfo;
+static QVector<ShaderInstanceInfo> shaderInstanceInfo;
+
+OpenGLUniformBufferObject *OpenGLMesh::m_modelInfo = 0;
+QOpenGLBuffer *OpenGLMesh::m_instanceBuffer = 0;
+
+OpenGLMesh::OpenGLMesh(Mesh * mesh, QObject* parent): QObject(0) {
+    m_host = mesh;
+    m_sizeFixed = false;
+    m_pickingID = 0;
+    m_geometry = 0;
+    m_lod = 0;
+    m_cullingEnabled = false;
+    m_dirtyBegin = m_dirtyEnd = 0;
+    m_indicesDirty = false;
+    if (m_host->material())
+        m_openGLMaterial = new OpenGLMaterial(m_host->material());
+    else
+        m_openGLMaterial = 0;
+
+    connect(m_host, SIGNAL(materialChanged(Material*)), this, SLOT(materialChanged(Material*)));
+    connect(m_host, SIGNAL(geometryChanged(QVector<Vertex>, QVector<uint32_t>)), this, SLOT(geometryChanged(QVector<Vertex>, QVector<uint32_t>)));
+    connect(m_host, SIGNAL(verticesUpdated(int, int)), this, SLOT(verticesUpdated(int, int)));
+    connect(m_host, SIGNAL(lodsChanged()), this, SLOT(lodsChanged()));
+    connect(m_host, SIGNAL(meshletsChanged()), this, SLOT(meshletsChanged()));
+    connect(m_host, SIGNAL(vertexLayoutChanged(int)), this, SLOT(vertexLayoutChanged(int)));
+    connect(m_host, SIGNAL(destroyed(QObject*)), this, SLOT(hostDestroyed(QObject*)));
+
+    setParent(parent);
+}
+
+OpenGLMesh::~OpenGLMesh() {
+    this->destroy();
+}
+
+Mesh * OpenGLMesh::host() const {
+    return m_host;
+}
+
+void OpenGLMesh::create() {
+    this->destroy();
+
+    m_geometry = OpenGLGeometry::acquire(m_host, resolveVertexLayout());
+    m_dirtyBegin = m_dirtyEnd = 0;
+    m_indicesDirty = false;
+    glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
+}
+
+void OpenGLMesh::commit(bool instanced) {
+    QMatrix4x4 modelMat = m_host->globalModelMatrix();
+    int flags = m_host->effectiveFlags();
+
+    memcpy(shaderModelInfo.modelMat, modelMat.constData(), 64);
+    memcpy(shaderModelInfo.normalMat, QMatrix4x4(m_host->globalNormalMatrix()).constData(), 64);
+    shaderModelInfo.sizeFixed = this->m_sizeFixed;
+    shaderModelInfo.selected = (flags & AbstractEntity::Selected) != 0;
+    shaderModelInfo.highlighted = (flags & AbstractEntity::Highlighted) != 0;
+    shaderModelInfo.pickingID = this->m_pickingID;
+    const VertexLayout& layout = m_geometry->layout();
+    shaderModelInfo.vertexLayout = layout.options();
+    shaderModelInfo.instanced = instanced;
+    shaderModelInfo.positionOffset = QVector4D(layout.positionOffset(), 0.0f);
+    shaderModelInfo.positionScale = QVector4D(layout.positionScale(), 1.0f);
+
+    if (m_modelInfo == 0) {
+        m_modelInfo = new OpenGLUniformBufferObject;
+        m_modelInfo->create();
+        m_modelInfo->bind();
+        m_modelInfo->allocate(MODEL_INFO_BINDING_POINT, NULL, sizeof(ShaderModelInfo));
+        m_modelInfo->release();
+    }
+    m_modelInfo->bind();
+    m_modelInfo->write(0, &shaderModelInfo, sizeof(ShaderModelInfo));
+    m_modelInfo->release();
+}
+
+int OpenGLMesh::render(bool pickingPass) {
+    int flags = m_host->effectiveFlags();
+    if (!(flags & AbstractEntity::Visible)) return 0;
+    update();
+    commit();
+
+    bool wireFrame = !pickingPass && (flags & AbstractEntity::WireFrame);
+    if (wireFrame)
+        glFuncs->glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+    else if (m_openGLMaterial)
+        m_openGLMaterial->bind();
+
+    m_geometry->bind();
+
+    int level = lod();
+    GLenum indexType = m_geometry->indexType();
+    GLsizei count = (GLsizei) m_geometry->lodIndexCount(level);
+    void* offset = (void*) intptr_t(m_geometry->lodOffset(level) * m_geometry->indexSize());
+    int primitives;
+    if (m_host->meshType() == Mesh::Triangle && level == 0 && m_cullingEnabled && m_host->meshlets().size()) {
+        // Back faces are visible in wireframe mode
+        primitives = drawMeshlets(!wireFrame);
+    } else if (m_host->meshType() == Mesh::Triangle) {
+        glFuncs->glDrawElements(GL_TRIANGLES, count, indexType, offset);
+        primitives = count / 3;
+    } else if (m_host->meshType() == Mesh::Line) {
+        glFuncs->glDrawElements(GL_LINES, count, indexType, offset);
+        primitives = count / 2;
+    } else {
+        glFuncs->glDrawElements(GL_POINTS, count, indexType, offset);
+        primitives = count;
+    }
+
+    m_geometry->release();
+
+    if (wireFrame)
+        glFuncs->glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    else if (m_openGLMaterial)
+        m_openGLMaterial->release();
+
+    return primitives;
+}
+
+int OpenGLMesh::renderInstanced(const QVector<OpenGLMesh*>& instances, bool pickingPass) {
+    update();
+
+    // Per-instance transforms, picking IDs and selection flags
+    shaderInstanceInfo.resize(instances.size());
+    for (int i = 0; i < instances.size(); i++) {
+        Mesh* mesh = instances[i]->m_host;
+        memcpy(shaderInstanceInfo[i].modelMat, mesh->globalModelMatrix().constData(), 64);
+        memcpy(shaderInstanceInfo[i].normalMat, mesh->globalNormalMatrix().constData(), 36);
+        shaderInstanceInfo[i].pickingID = instances[i]->m_pickingID;
+        shaderInstanceInfo[i].flags = mesh->effectiveFlags();
+    }
+
+    if (m_instanceBuffer == 0) {
+        m_instanceBuffer = new QOpenGLBuffer(QOpenGLBuffer::VertexBuffer);
+        m_instanceBuffer->setUsagePattern(QOpenGLBuffer::StreamDraw);
+        m_instanceBuffer->create();
+    }
+
+    commit(true);
+
+    if (!pickingPass && m_openGLMaterial)
+        m_openGLMaterial->bind();
+
+    m_geometry->bind();
+    m_instanceBuffer->bind();
+    m_instanceBuffer->allocate(shaderInstanceInfo.constData(), int(sizeof(ShaderInstanceInfo) * shaderInstanceInfo.size()));
+
+    GLsizei stride = sizeof(ShaderInstanceInfo);
+    for (int i = 0; i < 4; i++) {
+        glFuncs->glEnableVertexAttribArray(5 + i);
+        glFuncs->glVertexAttribPointer(5 + i, 4, GL_FLOAT, GL_FALSE, stride, (void*) intptr_t(16 * i));
+        glFuncs->glVertexAttribDivisor(5 + i, 1);
+    }
+    for (int i = 0; i < 3; i++) {
+        glFuncs->glEnableVertexAttribArray(9 + i);
+        glFuncs->glVertexAttribPointer(9 + i, 3, GL_FLOAT, GL_FALSE, stride, (void*) intptr_t(64 + 12 * i));
+        glFuncs->glVertexAttribDivisor(9 + i, 1);
+    }
+    glFuncs->glEnableVertexAttribArray(12);
+    glFuncs->glVertexAttribIPointer(12, 2, GL_UNSIGNED_INT, stride, (void*) intptr_t(100));
+    glFuncs->glVertexAttribDivisor(12, 1);
+
+    int level = lod();
+    GLsizei count = (GLsizei) m_geometry->lodIndexCount(level);
+    void* offset = (void*) intptr_t(m_geometry->lodOffset(level) * m_geometry->indexSize());
+    glFuncs->glDrawElementsInstanced(GL_TRIANGLES, count, m_geometry->indexType(), offset, instances.size());
+
+    // The vertex array is shared with meshes drawn one at a time
+    for (int location = 5; location <= 12; location++)
+        glFuncs->glDisableVertexAttribArray(location);
+
+    m_instanceBuffer->release();
+    m_geometry->release();
+
+    if (!pickingPass && m_openGLMaterial)
+        m_openGLMaterial->release();
+
+    return count / 3 * instances.size();
+}
+
+// Bring the buffers up to date with the host geometry. Buffers shared with other
+// meshes still hold their geometry, so the host gets buffers of its own instead.
+void OpenGLMesh::update() {
+    if (m_geometry == 0) {
+        create();
+        return;
+    }
+    if (!m_geometry->layout().hasTangents() && resolveVertexLayout() != m_geometry->layout().options()) {
+        create();
+        return;
+    }
+    if (m_geometry->geometryId() == m_host->geometryId()) return;
+
+    bool dirty = m_dirtyEnd > m_dirtyBegin || m_indicesDirty;
+    if (m_geometry->refCount() > 1 || !dirty || !m_geometry->update(m_host, m_dirtyBegin, m_dirtyEnd, m_indicesDirty))
+        create();
+
+    m_dirtyBegin = m_dirtyEnd = 0;
+    m_indicesDirty = false;
+}
+
+void OpenGLMesh::destroy() {
+    if (m_geometry) m_geometry->drop();
+    m_geometry = 0;
+}
+
+OpenGLGeometry * OpenGLMesh::geometry() const {
+    return m_geometry;
+}
+
+int OpenGLMesh::lod() const {
+    return m_geometry ? qBound(0, m_lod, m_geometry->lodCount() - 1) : 0;
+}
+
+bool OpenGLMesh::sizeFixed() const {
+    return m_sizeFixed;
+}
+
+void OpenGLMesh::setSizeFixed(bool sizeFixed) {
+    m_sizeFixed = sizeFixed;
+}
+
+void OpenGLMesh::setPickingID(uint id) {
+    m_pickingID = id;
+}
+
+void OpenGLMesh::setLod(int level) {
+    m_lod = level;
+}
+
+void OpenGLMesh::setCullingView(const QMatrix4x4& projViewMat, QVector3D viewPos) {
+    m_cullingEnabled = true;
+    m_projViewMat = projViewMat;
+    m_viewPos = viewPos;
+}
+
+int OpenGLMesh::drawMeshlets(bool coneCulling) {
+    const QVector<Meshlet>& meshlets = m_host->meshlets();
+    QMatrix4x4 modelMat = m_host->globalModelMatrix();
+
+    // Both tests run in the mesh's own space. Facing is kept by affine transforms
+    // unless they mirror, which turns every cone inside out.
+    Frustum frustum(m_projViewMat * modelMat);
+    QVector3D viewPos = modelMat.inverted() * m_viewPos;
+    coneCulling = coneCulling && modelMat.determinant() > 0.0;
+
+    GLenum indexType = m_geometry->indexType();
+    int indexSize = m_geometry->indexSize();
+    int runBegin = 0, runEnd = 0, drawn = 0;
+    for (int i = 0; i <= meshlets.size(); i++) {
+        bool visible = i < meshlets.size() && frustum.intersects(meshlets[i].bounds) &&
+                       !(coneCulling && meshlets[i].isBackFacing(viewPos));
+        if (visible && runEnd == meshlets[i].indexOffset && runEnd > runBegin) {
+            runEnd += meshlets[i].indexCount; // extend the current run
+            continue;
+        }
+        if (runEnd > runBegin) {
+            glFuncs->glDrawElements(GL_TRIANGLES, runEnd - runBegin, indexType, (void*) intptr_t(runBegin * indexSize));
+            drawn += runEnd - runBegin;
+        }
+        if (visible) {
+            runBegin = meshlets[i].indexOffset;
+            runEnd = runBegin + meshlets[i].indexCount;
+        } else
+            runBegin = runEnd = 0;
+    }
+    return drawn / 3;
+}
+
+bool OpenGLMesh::positionRangeChanged() const {
+    if (!(m_geometry->layout().options() & VertexLayout::QuantizedPositions)) return false;
+    const AABB& box = m_host->localBoundingBox();
+    return box.minimum != m_geometry->positionRange().minimum || box.maximum != m_geometry->positionRange().maximum;
+}
+
+int OpenGLMesh::resolveVertexLayout() const {
+    int options = m_host->vertexLayout();
+    if ((options & VertexLayout::OptionalTangents) &&
+        (m_host->material() == 0 || m_host->material()->bumpTexture().isNull()))
+        options |= VertexLayout::NoTangents;
+    return options;
+}
+
+void OpenGLMesh::childEvent(QChildEvent * e) {
+    if (e->removed()) {
+        if (e->child() == m_openGLMaterial)
+            m_openGLMaterial = 0;
+    }
+}
+
+void OpenGLMesh::materialChanged(Material * material) {
+    if (material == 0)
+        m_openGLMaterial = 0;
+    else
+        m_openGLMaterial = new OpenGLMaterial(material);
+}
+
+void OpenGLMesh::geometryChanged(const QVector<Vertex>&, const QVector<uint32_t>& indices) {
+    // Buffers of the same size are refilled in place, anything else is rebuilt on the next render
+    if (m_geometry == 0) return;
+    if (m_host->vertexCount() != m_geometry->vertexCount() || indices.size() != m_geometry->indexCount() || positionRangeChanged()) {
+        this->destroy();
+        return;
+    }
+    m_dirtyBegin = 0;
+    m_dirtyEnd = m_geometry->vertexCount();
+    m_indicesDirty = true;
+}
+
+void OpenGLMesh::verticesUpdated(int offset, int count) {
+    if (m_geometry == 0) return;
+    if (positionRangeChanged()) { // every vertex has to be requantized
+        this->destroy();
+        return;
+    }
+    if (m_dirtyEnd > m_dirtyBegin) {
+        m_dirtyBegin = qMin(m_dirtyBegin, offset);
+        m_dirtyEnd = qMax(m_dirtyEnd, offset + count);
+    } else {
+        m_dirtyBegin = offset;
+        m_dirtyEnd = offset + count;
+    }
+}
+
+void OpenGLMesh::lodsChanged() {
+    if (m_geometry == 0) return;
+    m_indicesDirty = true;
+}
+
+void OpenGLMesh::meshletsChanged() {
+    if (m_geometry == 0) return;
+    m_indicesDirty = true;
+}
+
+void OpenGLMesh::vertexLayoutChanged(int) {
+    this->destroy();
+}
+
+void OpenGLMesh::hostDestroyed(QObject *) {
+    // Commit suicide
+    delete this;
+}
@@ -1,237 +1,458 @@
-#include <OpenGLScene.h>
-
-struct ShaderAxisInfo { // struct size: 64
-    //                         // base align  // aligned offset
-    float hostModelMat[16];    // 64          // 0
-} shaderAxisInfo;
-
-struct ShaderCameraInfo { // struct size: 144
-    //                         // base align  // aligned offset
-    float projMat[16];         // 64          // 0
-    float viewMat[16];         // 64          // 64
-    QVector4D cameraPos;       // 16          // 128
-} shaderCameraInfo;
-
-struct ShaderAmbientLight { // struct size: 16
-    //                         // base align  // aligned offset
-    QVector4D color;           // 16          // 0
-};
-
-struct ShaderDirectionalLight { // struct size: 32
-    //                         // base align  // aligned offset
-    QVector4D color;           // 16          // 0
-    QVector4D direction;       // 16          // 16
-};
-
-struct ShaderPointLight { // struct size: 48
-    //                           // base align  // aligned offset
-    QVector4D color;             // 16          // 0
-    QVector4D pos;               // 16          // 16
-    QVector4D attenuation;       // 16          // 32
-};
-
-struct ShaderSpotLight { // struct size: 80
-    //                           // base align  // aligned offset
-    QVector4D color;             // 16          // 0
-    QVector4D pos;               // 16          // 16
-    QVector4D direction;         // 16          // 32
-    QVector4D attenuation;       // 16          // 48
-    QVector4D cutOff;            // 16          // 64
-};
-
-struct ShaderlightInfo { // struct size: 1424
-    //                                          // base align  // aligned offset
-    int ambientLightNum;                        // 4           // 0
-    int directionalLightNum;                    // 4           // 4
-    int pointLightNum;                          // 4           // 8
-    int spotLightNum;                           // 4           // 12
-    ShaderAmbientLight ambientLight[8];         // 16          // 16
-    ShaderDirectionalLight directionalLight[8]; // 32          // 144
-    ShaderPointLight pointLight[8];             // 48          // 400
-    ShaderSpotLight spotLight[8];               // 80          // 784
-};
-
-static ShaderlightInfo shaderlightInfo;
-
-OpenGLUniformBufferObject *OpenGLScene::m_cameraInfo = 0;
-OpenGLUniformBufferObject *OpenGLScene::m_lightInfo = 0;
-
-OpenGLScene::OpenGLScene(Scene * scene) {
-    m_host = scene;
-
-    this->gizmoAdded(m_host->transformGizmo());
-    for (int i = 0; i < m_host->gridlines().size(); i++)
-        this->gridlineAdded(m_host->gridlines()[i]);
-    for (int i = 0; i < m_host->pointLights().size(); i++)
-        this->lightAdded(m_host->pointLights()[i]);
-    for (int i = 0; i < m_host->spotLights().size(); i++)
-        this->lightAdded(m_host->spotLights()[i]);
-    for (int i = 0; i < m_host->models().size(); i++)
-        this->modelAdded(m_host->models()[i]);
-
-    connect(m_host, SIGNAL(gridlineAdded(Gridline*)), this, SLOT(gridlineAdded(Gridline*)));
-    connect(m_host, SIGNAL(lightAdded(AbstractLight*)), this, SLOT(lightAdded(AbstractLight*)));
-    connect(m_host, SIGNAL(modelAdded(Model*)), this, SLOT(modelAdded(Model*)));
-    connect(m_host, SIGNAL(destroyed(QObject*)), this, SLOT(hostDestroyed(QObject*)));
-}
-
-Scene * OpenGLScene::host() const {
-    return m_host;
-}
-
-OpenGLMesh * OpenGLScene::pick(uint32_t pickingID) {
-    if (pickingID >= 1000 && pickingID - 1000 < (uint32_t) m_normalMeshes.size())
-        return m_normalMeshes[pickingID - 1000];
-    else if (pickingID >= 100 && pickingID - 100 < (uint32_t) m_lightMeshes.size())
-        return m_lightMeshes[pickingID - 100];
-    else if (pickingID >= 90 && pickingID - 90 < (uint32_t) m_gizmoMeshes.size())
-        return m_gizmoMeshes[pickingID - 90];
-    return 0;
-}
-
-void OpenGLScene::renderAxis() {
-    if (m_host->transformGizmo()->alwaysOnTop())
-        glClear(GL_DEPTH_BUFFER_BIT);
-    for (int i = 0; i < m_gizmoMeshes.size(); i++)
-        m_gizmoMeshes[i]->render();
-}
-
-void OpenGLScene::renderGridlines() {
-    for (int i = 0; i < m_gridlineMeshes.size(); i++)
-        m_gridlineMeshes[i]->render();
-}
-
-void OpenGLScene::renderLights() {
-    for (int i = 0; i < m_lightMeshes.size(); i++) {
-        m_lightMeshes[i]->setPickingID(100 + i);
-        m_lightMeshes[i]->render();
-    }
-}
-
-void OpenGLScene::renderModels(bool pickingPass) {
-    for (int i = 0; i < m_normalMeshes.size(); i++) {
-        m_normalMeshes[i]->setPickingID(1000 + i);
-        m_normalMeshes[i]->render(pickingPass);
-    }
-}
-
-void OpenGLScene::commitCameraInfo() {
-    if (!m_host->camera()) return;
-    memcpy(shaderCameraInfo.projMat, m_host->camera()->projectionMatrix().constData(), 64);
-    memcpy(shaderCameraInfo.viewMat, m_host->camera()->viewMatrix().constData(), 64);
-    shaderCameraInfo.cameraPos = m_host->camera()->position();
-
-    if (m_cameraInfo == 0) {
-        m_cameraInfo = new OpenGLUniformBufferObject;
-        m_cameraInfo->create();
-        m_cameraInfo->bind();
-        m_cameraInfo->allocate(CAMERA_INFO_BINDING_POINT, NULL, sizeof(ShaderCameraInfo));
-        m_cameraInfo->release();
-    }
-
-    m_cameraInfo->bind();
-    m_cameraInfo->write(0, &shaderCameraInfo, sizeof(ShaderCameraInfo));
-    m_cameraInfo->release();
-}
-
-void OpenGLScene::commitLightInfo() {
-    int ambientLightNum = 0, directionalLightNum = 0, pointLightNum = 0, spotLightNum = 0;
-    for (int i = 0; i < m_host->ambientLights().size(); i++)
-        if (m_host->ambientLights()[i]->enabled()) {
-            shaderlightInfo.ambientLight[ambientLightNum].color = m_host->ambientLights()[i]->color() * m_host->ambientLights()[i]->intensity();
-            ambientLightNum++;
-        }
-    for (int i = 0; i < m_host->directionalLights().size(); i++)
-        if (m_host->directionalLights()[i]->enabled()) {
-            shaderlightInfo.directionalLight[directionalLightNum].color = m_host->directionalLights()[i]->color() * m_host->directionalLights()[i]->intensity();
-            shaderlightInfo.directionalLight[directionalLightNum].direction = m_host->directionalLights()[i]->direction();
-            directionalLightNum++;
-        }
-    for (int i = 0; i < m_host->pointLights().size(); i++)
-        if (m_host->pointLights()[i]->enabled()) {
-            shaderlightInfo.pointLight[pointLightNum].color = m_host->pointLights()[i]->color() * m_host->pointLights()[i]->intensity();
-            shaderlightInfo.pointLight[pointLightNum].pos = m_host->pointLights()[i]->position();
-            shaderlightInfo.pointLight[pointLightNum].attenuation[0] = m_host->pointLights()[i]->enableAttenuation();
-            shaderlightInfo.pointLight[pointLightNum].attenuation[1] = m_host->pointLights()[i]->attenuationQuadratic();
-            shaderlightInfo.pointLight[pointLightNum].attenuation[2] = m_host->pointLights()[i]->attenuationLinear();
-            shaderlightInfo.pointLight[pointLightNum].attenuation[3] = m_host->pointLights()[i]->attenuationConstant();
-            pointLightNum++;
-        }
-    for (int i = 0; i < m_host->spotLights().size(); i++)
-        if (m_host->spotLights()[i]->enabled()) {
-            shaderlightInfo.spotLight[spotLightNum].color = m_host->spotLights()[i]->color() * m_host->spotLights()[i]->intensity();
-            shaderlightInfo.spotLight[spotLightNum].pos = m_host->spotLights()[i]->position();
-            shaderlightInfo.spotLight[spotLightNum].direction = m_host->spotLights()[i]->direction();
-            shaderlightInfo.spotLight[spotLightNum].attenuation[0] = m_host->spotLights()[i]->enableAttenuation();
-            shaderlightInfo.spotLight[spotLightNum].attenuation[1] = m_host->spotLights()[i]->attenuationQuadratic();
-            shaderlightInfo.spotLight[spotLightNum].attenuation[2] = m_host->spotLights()[i]->attenuationLinear();
-            shaderlightInfo.spotLight[spotLightNum].attenuation[3] = m_host->spotLights()[i]->attenuationConstant();
-            shaderlightInfo.spotLight[spotLightNum].cutOff[0] = (float) cos(rad(m_host->spotLights()[i]->innerCutOff()));
-            shaderlightInfo.spotLight[spotLightNum].cutOff[1] = (float) cos(rad(m_host->spotLights()[i]->outerCutOff()));
-            spotLightNum++;
-        }
-
-    shaderlightInfo.ambientLightNum = ambientLightNum;
-    shaderlightInfo.directionalLightNum = directionalLightNum;
-    shaderlightInfo.pointLightNum = pointLightNum;
-    shaderlightInfo.spotLightNum = spotLightNum;
-
-    if (m_lightInfo == 0) {
-        m_lightInfo = new OpenGLUniformBufferObject;
-        m_lightInfo->create();
-        m_lightInfo->bind();
-        m_lightInfo->allocate(LIGHT_INFO_BINDING_POINT, NULL, sizeof(ShaderlightInfo));
-        m_lightInfo->release();
-    }
-    m_lightInfo->bind();
-    m_lightInfo->write(0, &shaderlightInfo, sizeof(ShaderlightInfo));
-    m_lightInfo->release();
-}
-
-void OpenGLScene::childEvent(QChildEvent * e) {
-    if (e->removed()) {
-        for (int i = 0; i < m_gridlineMeshes.size(); i++)
-            if (m_gridlineMeshes[i] == e->child())
-                m_gridlineMeshes.removeAt(i);
-        for (int i = 0; i < m_lightMeshes.size(); i++)
-            if (m_lightMeshes[i] == e->child())
-                m_lightMeshes.removeAt(i);
-        for (int i = 0; i < m_normalMeshes.size(); i++)
-            if (m_normalMeshes[i] == e->child())
-                m_normalMeshes.removeAt(i);
-    }
-}
-
-void OpenGLScene::gizmoAdded(AbstractGizmo* gizmo) {
-    for (int i = 0; i < gizmo->markers().size(); i++) {
-        m_gizmoMeshes.push_back(new OpenGLMesh(gizmo->markers()[i], this));
-        m_gizmoMeshes.back()->setSizeFixed(true);
-        m_gizmoMeshes.back()->setPickingID(90 + i);
-    }
-}
-
-void OpenGLScene::gridlineAdded(Gridline * gridline) {
-    m_gridlineMeshes.push_back(new OpenGLMesh(gridline->marker(), this));
-}
-
-void OpenGLScene::lightAdded(AbstractLight * light) {
-    if (light->marker())
-        m_lightMeshes.push_back(new OpenGLMesh(light->marker(), this));
-}
-
-void OpenGLScene::modelAdded(Model * model) {
-    connect(model, SIGNAL(childMeshAdded(Mesh*)), this, SLOT(meshAdded(Mesh*)));
-    for (int i = 0; i < model->childMeshes().size(); i++)
-        meshAdded(model->childMeshes()[i]);
-    for (int i = 0; i < model->childModels().size(); i++)
-        modelAdded(model->childModels()[i]);
-}
-
-void OpenGLScene::meshAdded(Mesh* mesh) {
-    m_normalMeshes.push_back(new OpenGLMesh(mesh, this));
-}
-
-void OpenGLScene::hostDestroyed(QObject *) {
-    // Commit suicide
-    delete this;
-}
+#include <OpenGLScene.h>
+#include <FrustumCuller.h>
+
+struct ShaderAxisInfo { // struct size: 64
+    //                         // base align  // aligned offset
+    float hostModelMat[16];    // 64          // 0
+} shaderAxisInfo;
+
+struct ShaderCameraInfo { // struct size: 144
+    //                         // base align  // aligned offset
+    float projMat[16];         // 64          // 0
+    float viewMat[16];         // 64          // 64
+    QVector4D cameraPos;       // 16          // 128
+} shaderCameraInfo;
+
+struct ShaderAmbientLight { // struct size: 16
+    //                         // base align  // aligned offset
+    QVector4D color;           // 16          // 0
+};
+
+struct ShaderDirectionalLight { // struct size: 32
+    //                         // base align  // aligned offset
+    QVector4D color;           // 16          // 0
+    QVector4D direction;       // 16          // 16
+};
+
+struct ShaderPointLight { // struct size: 48
+    //                           // base align  // aligned offset
+    QVector4D color;             // 16          // 0
+    QVector4D pos;               // 16          // 16
+    QVector4D attenuation;       // 16          // 32
+};
+
+struct ShaderSpotLight { // struct size: 80
+    //                           // base align  // aligned offset
+    QVector4D color;             // 16          // 0
+    QVector4D pos;               // 16          // 16
+    QVector4D direction;         // 16          // 32
+    QVector4D attenuation;       // 16          // 48
+    QVector4D cutOff;            // 16          // 64
+};
+
+struct ShaderlightInfo { // struct size: 1424
+    //                                          // base align  // aligned offset
+    int ambientLightNum;                        // 4           // 0
+    int directionalLightNum;                    // 4           // 4
+    int pointLightNum;                          // 4           // 8
+    int spotLightNum;                           // 4           // 12
+    ShaderAmbientLight ambientLight[8];         // 16          // 16
+    ShaderDirectionalLight directionalLight[8]; // 32          // 144
+    ShaderPointLight pointLight[8];             // 48          // 400
+    ShaderSpotLight spotLight[8];               // 80          // 784
+};
+
+static ShaderlightInfo shaderlightInfo;
+
+// Models covering at least this fraction of the screen height are drawn at full detail,
+// every halving of the size goes one level coarser
+static const float lodFullDetailSize = 0.5f;
+
+// Fraction of a level the size has to move past a switching point before the level changes
+static const float lodHysteresis = 0.1f;
+
+// Smallest group of meshes drawn with a single instanced call
+static const int minInstanceCount = 2;
+
+// Materials that bind to the same shader inputs, copies of a mesh own equal materials
+static bool sameMaterial(Material* a, Material* b) {
+    if (a == b) return true;
+    if (a == 0 || b == 0) return false;
+    return a->color() == b->color() && a->ambient() == b->ambient() && a->diffuse() == b->diffuse() &&
+           a->specular() == b->specular() && a->shininess() == b->shininess() &&
+           a->diffuseTexture() == b->diffuseTexture() && a->specularTexture() == b->specularTexture() &&
+           a->bumpTexture() == b->bumpTexture();
+}
+
+OpenGLUniformBufferObject *OpenGLScene::m_cameraInfo = 0;
+OpenGLUniformBufferObject *OpenGLScene::m_lightInfo = 0;
+
+OpenGLScene::OpenGLScene(Scene * scene) {
+    m_host = scene;
+    m_submittedTriangles = 0;
+    m_testedModels = m_culledModels = 0;
+    m_testedLights = m_culledLights = 0;
+
+    this->gizmoAdded(m_host->transformGizmo());
+    for (int i = 0; i < m_host->gridlines().size(); i++)
+        this->gridlineAdded(m_host->gridlines()[i]);
+    for (int i = 0; i < m_host->pointLights().size(); i++)
+        this->lightAdded(m_host->pointLights()[i]);
+    for (int i = 0; i < m_host->spotLights().size(); i++)
+        this->lightAdded(m_host->spotLights()[i]);
+    for (int i = 0; i < m_host->models().size(); i++)
+        this->modelAdded(m_host->models()[i]);
+
+    connect(m_host, SIGNAL(gridlineAdded(Gridline*)), this, SLOT(gridlineAdded(Gridline*)));
+    connect(m_host, SIGNAL(lightAdded(AbstractLight*)), this, SLOT(lightAdded(AbstractLight*)));
+    connect(m_host, SIGNAL(modelAdded(Model*)), this, SLOT(modelAdded(Model*)));
+    connect(m_host, SIGNAL(destroyed(QObject*)), this, SLOT(hostDestroyed(QObject*)));
+}
+
+Scene * OpenGLScene::host() const {
+    return m_host;
+}
+
+OpenGLMesh * OpenGLScene::pick(uint32_t pickingID) {
+    if (pickingID >= 1000 && pickingID - 1000 < (uint32_t) m_normalMeshes.size())
+        return m_normalMeshes[pickingID - 1000];
+    else if (pickingID >= 100 && pickingID - 100 < (uint32_t) m_lightMeshes.size())
+        return m_lightMeshes[pickingID - 100];
+    else if (pickingID >= 90 && pickingID - 90 < (uint32_t) m_gizmoMeshes.size())
+        return m_gizmoMeshes[pickingID - 90];
+    return 0;
+}
+
+OpenGLMesh * OpenGLScene::pick(const Line & ray, RayHit * hit) {
+    RayHit nearestHit, candidate;
+    OpenGLMesh* nearest = 0;
+
+    for (int i = 0; i < m_gizmoMeshes.size(); i++)
+        if (raycast(m_gizmoMeshes[i], ray, candidate, nearestHit.distance)) {
+            nearestHit = candidate;
+            nearest = m_gizmoMeshes[i];
+        }
+    // The axis is drawn after clearing the depth buffer
+    if (nearest && m_host->transformGizmo()->alwaysOnTop()) {
+        if (hit) *hit = nearestHit;
+        return nearest;
+    }
+
+    for (int i = 0; i < m_lightMeshes.size(); i++)
+        if (raycast(m_lightMeshes[i], ray, candidate, nearestHit.distance)) {
+            nearestHit = candidate;
+            nearest = m_lightMeshes[i];
+        }
+
+    Mesh* mesh = m_host->raycast(ray, &candidate);
+    if (mesh && candidate.distance < nearestHit.distance && m_meshMap.contains(mesh)) {
+        nearestHit = candidate;
+        nearest = m_meshMap[mesh];
+    }
+
+    if (nearest && hit) *hit = nearestHit;
+    return nearest;
+}
+
+bool OpenGLScene::hasLineOrPointMeshes() const {
+    for (int i = 0; i < m_normalMeshes.size(); i++)
+        if (m_normalMeshes[i]->host()->meshType() != Mesh::Triangle)
+            return true;
+    return false;
+}
+
+void OpenGLScene::renderAxis() {
+    if (m_host->transformGizmo()->alwaysOnTop())
+        glClear(GL_DEPTH_BUFFER_BIT);
+    for (int i = 0; i < m_gizmoMeshes.size(); i++)
+        m_gizmoMeshes[i]->render();
+}
+
+void OpenGLScene::renderGridlines() {
+    for (int i = 0; i < m_gridlineMeshes.size(); i++)
+        m_gridlineMeshes[i]->render();
+}
+
+void OpenGLScene::renderLights(bool pickingPass) {
+    for (int i = 0; i < m_lightMeshes.size(); i++)
+        m_lightMeshes[i]->setPickingID(100 + i);
+
+    QVector<int> visible;
+    if (m_host->camera()) {
+        QVector<AABB> boxes(m_lightMeshes.size());
+        for (int i = 0; i < m_lightMeshes.size(); i++)
+            boxes[i] = modelMatrix(m_lightMeshes[i]) * m_lightMeshes[i]->host()->localBoundingBox();
+        Frustum frustum(m_host->camera()->projectionMatrix() * m_host->camera()->viewMatrix());
+        FrustumCuller(frustum).cull(boxes.constData(), boxes.size(), visible);
+    } else {
+        visible.resize(m_lightMeshes.size());
+        for (int i = 0; i < visible.size(); i++)
+            visible[i] = i;
+    }
+
+    for (int i = 0; i < visible.size(); i++)
+        m_lightMeshes[visible[i]]->render();
+
+    if (!pickingPass) {
+        m_testedLights = m_lightMeshes.size();
+        m_culledLights = m_lightMeshes.size() - visible.size();
+    }
+}
+
+void OpenGLScene::renderModels(bool pickingPass) {
+    QMatrix4x4 projViewMat;
+    if (m_host->camera())
+        projViewMat = m_host->camera()->projectionMatrix() * m_host->camera()->viewMatrix();
+
+    // Only the meshes the scene index finds in the view frustum are drawn
+    QVector<OpenGLMesh*> openGLMeshes;
+    if (m_host->camera()) {
+        QVector<Mesh*> meshes = m_host->meshesInFrustum(Frustum(projViewMat));
+        openGLMeshes.reserve(meshes.size());
+        for (int i = 0; i < meshes.size(); i++)
+            if (OpenGLMesh* openGLMesh = m_meshMap.value(meshes[i], 0))
+                openGLMeshes.push_back(openGLMesh);
+    } else
+        openGLMeshes = m_normalMeshes;
+
+    // Meshes drawing the same buffers at the same level of detail are instanced,
+    // everything that can't be is drawn on its own
+    QHash<QPair<OpenGLGeometry*, int>, QVector<OpenGLMesh*>> groups;
+    int triangles = 0;
+    for (int i = 0; i < openGLMeshes.size(); i++) {
+        OpenGLMesh* openGLMesh = openGLMeshes[i];
+        // The picking pass reuses the levels of the last frame
+        if (!pickingPass)
+            selectLod(openGLMesh);
+        if (m_host->camera())
+            openGLMesh->setCullingView(projViewMat, m_host->camera()->position());
+        if (isInstanceable(openGLMesh, pickingPass)) {
+            openGLMesh->update();
+            groups[qMakePair(openGLMesh->geometry(), openGLMesh->lod())].push_back(openGLMesh);
+            continue;
+        }
+        int primitives = openGLMesh->render(pickingPass);
+        if (openGLMesh->host()->meshType() == Mesh::Triangle)
+            triangles += primitives;
+    }
+
+    QVector<QVector<OpenGLMesh*>> batches;
+    for (QHash<QPair<OpenGLGeometry*, int>, QVector<OpenGLMesh*>>::iterator it = groups.begin(); it != groups.end(); ++it) {
+        batches.clear();
+        for (int i = 0; i < it.value().size(); i++) {
+            OpenGLMesh* openGLMesh = it.value()[i];
+            int j = 0;
+            while (j < batches.size() && !sameMaterial(batches[j][0]->host()->material(), openGLMesh->host()->material())) j++;
+            if (j == batches.size())
+                batches.push_back(QVector<OpenGLMesh*>());
+            batches[j].push_back(openGLMesh);
+        }
+        for (int j = 0; j < batches.size(); j++) {
+            if (batches[j].size() >= minInstanceCount)
+                triangles += batches[j][0]->renderInstanced(batches[j], pickingPass);
+            else
+                for (int k = 0; k < batches[j].size(); k++)
+                    triangles += batches[j][k]->render(pickingPass);
+        }
+    }
+
+    if (!pickingPass) {
+        m_submittedTriangles = triangles;
+        m_testedModels = m_normalMeshes.size();
+        m_culledModels = m_normalMeshes.size() - openGLMeshes.size();
+    }
+}
+
+int OpenGLScene::submittedTriangles() const {
+    return m_submittedTriangles;
+}
+
+int OpenGLScene::testedObjects() const {
+    return m_testedModels + m_testedLights;
+}
+
+int OpenGLScene::culledObjects() const {
+    return m_culledModels + m_culledLights;
+}
+
+// Picking IDs follow the positions in m_normalMeshes, see pick()
+void OpenGLScene::renumberNormalMeshes() {
+    for (int i = 0; i < m_normalMeshes.size(); i++)
+        m_normalMeshes[i]->setPickingID(1000 + i);
+}
+
+void OpenGLScene::selectLod(OpenGLMesh * openGLMesh) {
+    Mesh* mesh = openGLMesh->host();
+    Camera* camera = m_host->camera();
+    if (mesh->lodCount() == 1 || camera == 0) {
+        openGLMesh->setLod(0);
+        return;
+    }
+
+    // Projected size of the bounding sphere as a fraction of the screen height
+    Sphere sphere = mesh->boundingSphere();
+    float distance = sphere.center.distanceToPoint(camera->position());
+    if (sphere.isEmpty() || distance <= sphere.radius) {
+        openGLMesh->setLod(0);
+        return;
+    }
+    float size = sphere.radius / (distance * float(tan(rad(camera->fieldOfView()) / 2)));
+    float level = size > 0.0f ? std::log2(lodFullDetailSize / size) : float(mesh->lodCount());
+
+    int current = openGLMesh->lod();
+    int target = qBound(0, qFloor(level), mesh->lodCount() - 1);
+    if (target > current && level < current + 1 + lodHysteresis)
+        target = current;
+    else if (target < current && level > current - lodHysteresis)
+        target = current;
+    openGLMesh->setLod(target);
+}
+
+// Markers drawn at a fixed screen size are scaled the way the vertex shader does it
+bool OpenGLScene::raycast(OpenGLMesh * openGLMesh, const Line & ray, RayHit & hit, float maxDistance) const {
+    Mesh* mesh = openGLMesh->host();
+    if (!mesh->visible()) return false;
+    return mesh->raycast(ray, modelMatrix(openGLMesh), hit, maxDistance);
+}
+
+// The model matrix as the vertex shader applies it, size fixed markers are
+// scaled with their distance to the camera
+QMatrix4x4 OpenGLScene::modelMatrix(OpenGLMesh * openGLMesh) const {
+    QMatrix4x4 modelMat = openGLMesh->host()->globalModelMatrix();
+    if (openGLMesh->sizeFixed() && m_host->camera()) {
+        QMatrix4x4 MVP = m_host->camera()->projectionMatrix() * m_host->camera()->viewMatrix() * modelMat;
+        float w = (MVP * QVector4D(0.0f, 0.0f, 0.0f, 1.0f)).w() / 100;
+        modelMat.scale(w);
+    }
+    return modelMat;
+}
+
+// Visible filled triangle meshes whose clusters aren't culled one by one
+bool OpenGLScene::isInstanceable(OpenGLMesh * openGLMesh, bool pickingPass) const {
+    Mesh* mesh = openGLMesh->host();
+    int flags = mesh->effectiveFlags();
+    if (!(flags & AbstractEntity::Visible) || mesh->meshType() != Mesh::Triangle) return false;
+    if (!pickingPass && (flags & AbstractEntity::WireFrame)) return false;
+    return mesh->meshlets().isEmpty() || openGLMesh->lod() > 0;
+}
+
+void OpenGLScene::commitCameraInfo() {
+    if (!m_host->camera()) return;
+    memcpy(shaderCameraInfo.projMat, m_host->camera()->projectionMatrix().constData(), 64);
+    memcpy(shaderCameraInfo.viewMat, m_host->camera()->viewMatrix().constData(), 64);
+    shaderCameraInfo.cameraPos = m_host->camera()->position();
+
+    if (m_cameraInfo == 0) {
+        m_cameraInfo = new OpenGLUniformBufferObject;
+        m_cameraInfo->create();
+        m_cameraInfo->bind();
+        m_cameraInfo->allocate(CAMERA_INFO_BINDING_POINT, NULL, sizeof(ShaderCameraInfo));
+        m_cameraInfo->release();
+    }
+
+    m_cameraInfo->bind();
+    m_cameraInfo->write(0, &shaderCameraInfo, sizeof(ShaderCameraInfo));
+    m_cameraInfo->release();
+}
+
+void OpenGLScene::commitLightInfo() {
+    int ambientLightNum = 0, directionalLightNum = 0, pointLightNum = 0, spotLightNum = 0;
+    for (int i = 0; i < m_host->ambientLights().size(); i++)
+        if (m_host->ambientLights()[i]->enabled()) {
+            shaderlightInfo.ambientLight[ambientLightNum].color = m_host->ambientLights()[i]->color() * m_host->ambientLights()[i]->intensity();
+            ambientLightNum++;
+        }
+    for (int i = 0; i < m_host->directionalLights().size(); i++)
+        if (m_host->directionalLights()[i]->enabled()) {
+            shaderlightInfo.directionalLight[directionalLightNum].color = m_host->directionalLights()[i]->color() * m_host->directionalLights()[i]->intensity();
+            shaderlightInfo.directionalLight[directionalLightNum].direction = m_host->directionalLights()[i]->direction();
+            directionalLightNum++;
+        }
+    for (int i = 0; i < m_host->pointLights().size(); i++)
+        if (m_host->pointLights()[i]->enabled()) {
+            shaderlightInfo.pointLight[pointLightNum].color = m_host->pointLights()[i]->color() * m_host->pointLights()[i]->intensity();
+            shaderlightInfo.pointLight[pointLightNum].pos = m_host->pointLights()[i]->position();
+            shaderlightInfo.pointLight[pointLightNum].attenuation[0] = m_host->pointLights()[i]->enableAttenuation();
+            shaderlightInfo.pointLight[pointLightNum].attenuation[1] = m_host->pointLights()[i]->attenuationQuadratic();
+            shaderlightInfo.pointLight[pointLightNum].attenuation[2] = m_host->pointLights()[i]->attenuationLinear();
+            shaderlightInfo.pointLight[pointLightNum].attenuation[3] = m_host->pointLights()[i]->attenuationConstant();
+            pointLightNum++;
+        }
+    for (int i = 0; i < m_host->spotLights().size(); i++)
+        if (m_host->spotLights()[i]->enabled()) {
+            shaderlightInfo.spotLight[spotLightNum].color = m_host->spotLights()[i]->color() * m_host->spotLights()[i]->intensity();
+            shaderlightInfo.spotLight[spotLightNum].pos = m_host->spotLights()[i]->position();
+            shaderlightInfo.spotLight[spotLightNum].direction = m_host->spotLights()[i]->direction();
+            shaderlightInfo.spotLight[spotLightNum].attenuation[0] = m_host->spotLights()[i]->enableAttenuation();
+            shaderlightInfo.spotLight[spotLightNum].attenuation[1] = m_host->spotLights()[i]->attenuationQuadratic();
+            shaderlightInfo.spotLight[spotLightNum].attenuation[2] = m_host->spotLights()[i]->attenuationLinear();
+            shaderlightInfo.spotLight[spotLightNum].attenuation[3] = m_host->spotLights()[i]->attenuationConstant();
+            shaderlightInfo.spotLight[spotLightNum].cutOff[0] = (float) cos(rad(m_host->spotLights()[i]->innerCutOff()));
+            shaderlightInfo.spotLight[spotLightNum].cutOff[1] = (float) cos(rad(m_host->spotLights()[i]->outerCutOff()));
+            spotLightNum++;
+        }
+
+    shaderlightInfo.ambientLightNum = ambientLightNum;
+    shaderlightInfo.directionalLightNum = directionalLightNum;
+    shaderlightInfo.pointLightNum = pointLightNum;
+    shaderlightInfo.spotLightNum = spotLightNum;
+
+    if (m_lightInfo == 0) {
+        m_lightInfo = new OpenGLUniformBufferObject;
+        m_lightInfo->create();
+        m_lightInfo->bind();
+        m_lightInfo->allocate(LIGHT_INFO_BINDING_POINT, NULL, sizeof(ShaderlightInfo));
+        m_lightInfo->release();
+    }
+    m_lightInfo->bind();
+    m_lightInfo->write(0, &shaderlightInfo, sizeof(ShaderlightInfo));
+    m_lightInfo->release();
+}
+
+void OpenGLScene::childEvent(QChildEvent * e) {
+    if (e->removed()) {
+        for (int i = 0; i < m_gridlineMeshes.size(); i++)
+            if (m_gridlineMeshes[i] == e->child())
+                m_gridlineMeshes.removeAt(i);
+        for (int i = 0; i < m_lightMeshes.size(); i++)
+            if (m_lightMeshes[i] == e->child())
+                m_lightMeshes.removeAt(i);
+        for (int i = 0; i < m_normalMeshes.size(); i++)
+            if (m_normalMeshes[i] == e->child()) {
+                m_normalMeshes.removeAt(i);
+                renumberNormalMeshes();
+            }
+        for (QHash<Mesh*, OpenGLMesh*>::iterator it = m_meshMap.begin(); it != m_meshMap.end();) {
+            if (it.value() == e->child())
+                it = m_meshMap.erase(it);
+            else
+                ++it;
+        }
+    }
+}
+
+void OpenGLScene::gizmoAdded(AbstractGizmo* gizmo) {
+    for (int i = 0; i < gizmo->markers().size(); i++) {
+        m_gizmoMeshes.push_back(new OpenGLMesh(gizmo->markers()[i], this));
+        m_gizmoMeshes.back()->setSizeFixed(true);
+        m_gizmoMeshes.back()->setPickingID(90 + i);
+    }
+}
+
+void OpenGLScene::gridlineAdded(Gridline * gridline) {
+    m_gridlineMeshes.push_back(new OpenGLMesh(gridline->marker(), this));
+}
+
+void OpenGLScene::lightAdded(AbstractLight * light) {
+    if (light->marker())
+        m_lightMeshes.push_back(new OpenGLMesh(light->marker(), this));
+}
+
+void OpenGLScene::modelAdded(Model * model) {
+    connect(model, SIGNAL(childMeshAdded(Mesh*)), this, SLOT(meshAdded(Mesh*)));
+    for (int i = 0; i < model->childMeshes().size(); i++)
+        meshAdded(model->childMeshes()[i]);
+    for (int i = 0; i < model->childModels().size(); i++)
+        modelAdded(model->childModels()[i]);
+}
+
+void OpenGLScene::meshAdded(Mesh* mesh) {
+    m_normalMeshes.push_back(new OpenGLMesh(mesh, this));
+    m_normalMeshes.back()->setPickingID(1000 + m_normalMeshes.size() - 1);
+    m_meshMap[mesh] = m_normalMeshes.back();
+}
+
+void OpenGLScene::hostDestroyed(QObject *) {
+    // Commit suicide
+    delete this;
+}
@@ -1,102 +1,179 @@
-#include <MeshProperty.h>
-
-MeshProperty::MeshProperty(Mesh * mesh, QWidget * parent): QWidget(parent) {
-    m_host = mesh;
-
-    m_visibleCheckBox = new QCheckBox("Visible", this);
-    m_wireFrameModeCheckBox = new QCheckBox("WireFrame Mode", this);
-    m_meshTypeTextLabel = new QLabel("Mesh Type:", this);
-    m_meshTypeValueLabel = new QLabel(this);
-    m_numOfVerticesTextLabel = new QLabel("Vertices:", this);
-    m_numOfVerticesValueLabel = new QLabel(QString::number(m_host->vertices().size()), this);
-    
-    if (m_host->meshType() == Mesh::Triangle) {
-        m_meshTypeValueLabel->setText("Triangle");
-        m_numOfFacesTextLabel = new QLabel("Faces:", this);
-        m_numOfFacesValueLabel = new QLabel(QString::number(m_host->indices().size() / 3), this);
-    } else if (m_host->meshType() == Mesh::Line) {
-        m_meshTypeValueLabel->setText("Line");
-        m_numOfFacesTextLabel = m_numOfFacesValueLabel = 0;
-    } else {
-        m_meshTypeValueLabel->setText("Point");
-        m_numOfFacesTextLabel = m_numOfFacesValueLabel = 0;
-    }
-    
-    m_positionEdit = new Vector3DEdit("Position", Qt::Horizontal, "X", "Y", "Z", -inf, inf, 2, this);
-    m_rotationEditSlider = new Vector3DEditSlider("Rotation", Qt::Horizontal, "X", "Y", "Z", -180.0f, 180.0f, 2, this);
-    m_scalingEdit = new Vector3DEdit("Scaling", Qt::Horizontal, "X", "Y", "Z", 0.0f, inf, 2, this);
-    
-    m_visibleCheckBox->setChecked(m_host->visible());
-    m_wireFrameModeCheckBox->setChecked(m_host->wireFrameMode());
-    m_positionEdit->setValue(m_host->position());
-    m_rotationEditSlider->setValue(m_host->rotation());
-    m_scalingEdit->setValue(m_host->scaling());
-
-    configLayout();
-    configSignals();
-}
-
-void MeshProperty::configLayout() {
-    QGridLayout * subLayout = new QGridLayout;
-    subLayout->setAlignment(Qt::AlignTop);
-    subLayout->setVerticalSpacing(10);
-    subLayout->addWidget(m_visibleCheckBox, 0, 0, 1, 2);
-    subLayout->addWidget(m_wireFrameModeCheckBox, 1, 0, 1, 2);
-    subLayout->addWidget(m_meshTypeTextLabel, 2, 0);
-    subLayout->addWidget(m_meshTypeValueLabel, 2, 1);
-    subLayout->addWidget(m_numOfVerticesTextLabel, 3, 0);
-    subLayout->addWidget(m_numOfVerticesValueLabel, 3, 1);
-    if (m_numOfFacesTextLabel && m_numOfFacesValueLabel) {
-        subLayout->addWidget(m_numOfFacesTextLabel, 4, 0);
-        subLayout->addWidget(m_numOfFacesValueLabel, 4, 1);
-    }
-    subLayout->addWidget(m_positionEdit, 5, 0, 1, 2);
-    subLayout->addWidget(m_rotationEditSlider, 6, 0, 1, 2);
-    subLayout->addWidget(m_scalingEdit, 7, 0, 1, 2);
-
-    setLayout(subLayout);
-}
-
-void MeshProperty::configSignals() {
-    connect(m_host, SIGNAL(destroyed(QObject*)), this, SLOT(hostDestroyed(QObject*)));
-    connect(m_host, SIGNAL(meshTypeChanged(int)), this, SLOT(meshTypeChanged(int)));
-    connect(m_host, SIGNAL(geometryChanged(QVector<Vertex>, QVector<uint32_t>)), this, SLOT(geometryChanged(QVector<Vertex>, QVector<uint32_t>)));
-
-    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_wireFrameModeCheckBox, SLOT(setEnabled(bool)));
-    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_positionEdit, SLOT(setEnabled(bool)));
-    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_rotationEditSlider, SLOT(setEnabled(bool)));
-    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_scalingEdit, SLOT(setEnabled(bool)));
-
-    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_host, SLOT(setVisible(bool)));
-    connect(m_wireFrameModeCheckBox, SIGNAL(toggled(bool)), m_host, SLOT(setWireFrameMode(bool)));
-    connect(m_positionEdit, SIGNAL(valueEdited(QVector3D)), m_host, SLOT(setPosition(QVector3D)));
-    connect(m_rotationEditSlider, SIGNAL(valueEdited(QVector3D)), m_host, SLOT(setRotation(QVector3D)));
-    connect(m_scalingEdit, SIGNAL(valueEdited(QVector3D)), m_host, SLOT(setScaling(QVector3D)));
-
-    connect(m_host, SIGNAL(visibleChanged(bool)), m_visibleCheckBox, SLOT(setChecked(bool)));
-    connect(m_host, SIGNAL(wireFrameModeChanged(bool)), m_wireFrameModeCheckBox, SLOT(setChecked(bool)));
-    connect(m_host, SIGNAL(positionChanged(QVector3D)), m_positionEdit, SLOT(setValue(QVector3D)));
-    connect(m_host, SIGNAL(rotationChanged(QVector3D)), m_rotationEditSlider, SLOT(setValue(QVector3D)));
-    connect(m_host, SIGNAL(scalingChanged(QVector3D)), m_scalingEdit, SLOT(setValue(QVector3D)));
-}
-
-void MeshProperty::hostDestroyed(QObject *) {
-    delete this;
-}
-
-void MeshProperty::meshTypeChanged(int meshType) {
-    if (meshType == Mesh::Triangle) {
-        m_meshTypeValueLabel->setText("Triangle");
-    } else if (meshType == Mesh::Line) {
-        m_meshTypeValueLabel->setText("Line");
-    } else {
-        m_meshTypeValueLabel->setText("Point");
-    }
-}
-
-void MeshProperty::geometryChanged(const QVector<Vertex>& vertices, const QVector<uint32_t>& indices) {
-    m_numOfVerticesValueLabel->setText(QString::number(vertices.size()));
-    if (m_host->meshType() == Mesh::Triangle && m_numOfFacesValueLabel)
-        m_numOfFacesValueLabel->setText(QString::number(indices.size() / 3));
-}
-
+#include <MeshProperty.h>
+
+MeshProperty::MeshProperty(Mesh * mesh, QWidget * parent): QWidget(parent) {
+    m_host = mesh;
+
+    m_visibleCheckBox = new QCheckBox("Visible", this);
+    m_wireFrameModeCheckBox = new QCheckBox("WireFrame Mode", this);
+    m_meshTypeTextLabel = new QLabel("Mesh Type:", this);
+    m_meshTypeValueLabel = new QLabel(this);
+    m_numOfVerticesTextLabel = new QLabel("Vertices:", this);
+    m_numOfVerticesValueLabel = new QLabel(QString::number(m_host->vertexCount()), this);
+    m_vertexLayoutTextLabel = new QLabel("Vertex Layout:", this);
+    m_vertexLayoutComboBox = new QComboBox(this);
+    m_vertexLayoutComboBox->addItem("Standard", int(VertexLayout::Standard));
+    m_vertexLayoutComboBox->addItem("Compact", int(VertexLayout::Compact));
+    m_vertexLayoutComboBox->addItem("Compact + Quantized", int(VertexLayout::Compact | VertexLayout::QuantizedPositions));
+    vertexLayoutChanged(m_host->vertexLayout());
+    
+    if (m_host->meshType() == Mesh::Triangle) {
+        m_meshTypeValueLabel->setText("Triangle");
+        m_numOfFacesTextLabel = new QLabel("Faces:", this);
+        m_numOfFacesValueLabel = new QLabel(QString::number(m_host->indices().size() / 3), this);
+        m_numOfLodsTextLabel = new QLabel("LODs:", this);
+        m_numOfLodsValueLabel = new QLabel(QString::number(m_host->lodCount() - 1), this);
+        m_generateLodsButton = new QPushButton("Generate LODs", this);
+        m_numOfMeshletsTextLabel = new QLabel("Meshlets:", this);
+        m_numOfMeshletsValueLabel = new QLabel(QString::number(m_host->meshlets().size()), this);
+        m_buildMeshletsButton = new QPushButton("Build Meshlets", this);
+    } else if (m_host->meshType() == Mesh::Line) {
+        m_meshTypeValueLabel->setText("Line");
+        m_numOfFacesTextLabel = m_numOfFacesValueLabel = 0;
+        m_numOfLodsTextLabel = m_numOfLodsValueLabel = 0;
+        m_generateLodsButton = 0;
+        m_numOfMeshletsTextLabel = m_numOfMeshletsValueLabel = 0;
+        m_buildMeshletsButton = 0;
+    } else {
+        m_meshTypeValueLabel->setText("Point");
+        m_numOfFacesTextLabel = m_numOfFacesValueLabel = 0;
+        m_numOfLodsTextLabel = m_numOfLodsValueLabel = 0;
+        m_generateLodsButton = 0;
+        m_numOfMeshletsTextLabel = m_numOfMeshletsValueLabel = 0;
+        m_buildMeshletsButton = 0;
+    }
+    
+    m_positionEdit = new Vector3DEdit("Position", Qt::Horizontal, "X", "Y", "Z", -inf, inf, 2, this);
+    m_rotationEditSlider = new Vector3DEditSlider("Rotation", Qt::Horizontal, "X", "Y", "Z", -180.0f, 180.0f, 2, this);
+    m_scalingEdit = new Vector3DEdit("Scaling", Qt::Horizontal, "X", "Y", "Z", 0.0f, inf, 2, this);
+    
+    m_visibleCheckBox->setChecked(m_host->visible());
+    m_wireFrameModeCheckBox->setChecked(m_host->wireFrameMode());
+    m_positionEdit->setValue(m_host->position());
+    m_rotationEditSlider->setValue(m_host->rotation());
+    m_scalingEdit->setValue(m_host->scaling());
+
+    configLayout();
+    configSignals();
+}
+
+void MeshProperty::configLayout() {
+    QGridLayout * subLayout = new QGridLayout;
+    subLayout->setAlignment(Qt::AlignTop);
+    subLayout->setVerticalSpacing(10);
+    subLayout->addWidget(m_visibleCheckBox, 0, 0, 1, 2);
+    subLayout->addWidget(m_wireFrameModeCheckBox, 1, 0, 1, 2);
+    subLayout->addWidget(m_meshTypeTextLabel, 2, 0);
+    subLayout->addWidget(m_meshTypeValueLabel, 2, 1);
+    subLayout->addWidget(m_numOfVerticesTextLabel, 3, 0);
+    subLayout->addWidget(m_numOfVerticesValueLabel, 3, 1);
+    subLayout->addWidget(m_vertexLayoutTextLabel, 4, 0);
+    subLayout->addWidget(m_vertexLayoutComboBox, 4, 1);
+    if (m_numOfFacesTextLabel && m_numOfFacesValueLabel) {
+        subLayout->addWidget(m_numOfFacesTextLabel, 5, 0);
+        subLayout->addWidget(m_numOfFacesValueLabel, 5, 1);
+    }
+    if (m_numOfLodsTextLabel && m_numOfLodsValueLabel && m_generateLodsButton) {
+        subLayout->addWidget(m_numOfLodsTextLabel, 6, 0);
+        subLayout->addWidget(m_numOfLodsValueLabel, 6, 1);
+        subLayout->addWidget(m_generateLodsButton, 7, 0, 1, 2);
+    }
+    if (m_numOfMeshletsTextLabel && m_numOfMeshletsValueLabel && m_buildMeshletsButton) {
+        subLayout->addWidget(m_numOfMeshletsTextLabel, 8, 0);
+        subLayout->addWidget(m_numOfMeshletsValueLabel, 8, 1);
+        subLayout->addWidget(m_buildMeshletsButton, 9, 0, 1, 2);
+    }
+    subLayout->addWidget(m_positionEdit, 10, 0, 1, 2);
+    subLayout->addWidget(m_rotationEditSlider, 11, 0, 1, 2);
+    subLayout->addWidget(m_scalingEdit, 12, 0, 1, 2);
+
+    setLayout(subLayout);
+}
+
+void MeshProperty::configSignals() {
+    connect(m_host, SIGNAL(destroyed(QObject*)), this, SLOT(hostDestroyed(QObject*)));
+    connect(m_host, SIGNAL(meshTypeChanged(int)), this, SLOT(meshTypeChanged(int)));
+    connect(m_host, SIGNAL(vertexLayoutChanged(int)), this, SLOT(vertexLayoutChanged(int)));
+    connect(m_vertexLayoutComboBox, SIGNAL(activated(int)), this, SLOT(vertexLayoutSelected(int)));
+    connect(m_host, SIGNAL(geometryChanged(QVector<Vertex>, QVector<uint32_t>)), this, SLOT(geometryChanged(QVector<Vertex>, QVector<uint32_t>)));
+    connect(m_host, SIGNAL(lodsChanged()), this, SLOT(lodsChanged()));
+    connect(m_host, SIGNAL(meshletsChanged()), this, SLOT(meshletsChanged()));
+    if (m_generateLodsButton)
+        connect(m_generateLodsButton, SIGNAL(clicked(bool)), this, SLOT(generateLods()));
+    if (m_buildMeshletsButton)
+        connect(m_buildMeshletsButton, SIGNAL(clicked(bool)), this, SLOT(buildMeshlets()));
+
+    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_wireFrameModeCheckBox, SLOT(setEnabled(bool)));
+    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_positionEdit, SLOT(setEnabled(bool)));
+    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_rotationEditSlider, SLOT(setEnabled(bool)));
+    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_scalingEdit, SLOT(setEnabled(bool)));
+
+    connect(m_visibleCheckBox, SIGNAL(toggled(bool)), m_host, SLOT(setVisible(bool)));
+    connect(m_wireFrameModeCheckBox, SIGNAL(toggled(bool)), m_host, SLOT(setWireFrameMode(bool)));
+    connect(m_positionEdit, SIGNAL(valueEdited(QVector3D)), m_host, SLOT(setPosition(QVector3D)));
+    connect(m_rotationEditSlider, SIGNAL(valueEdited(QVector3D)), m_host, SLOT(setRotation(QVector3D)));
+    connect(m_scalingEdit, SIGNAL(valueEdited(QVector3D)), m_host, SLOT(setScaling(QVector3D)));
+
+    connect(m_host, SIGNAL(visibleChanged(bool)), m_visibleCheckBox, SLOT(setChecked(bool)));
+    connect(m_host, SIGNAL(wireFrameModeChanged(bool)), m_wireFrameModeCheckBox, SLOT(setChecked(bool)));
+    connect(m_host, SIGNAL(positionChanged(QVector3D)), m_positionEdit, SLOT(setValue(QVector3D)));
+    connect(m_host, SIGNAL(rotationChanged(QVector3D)), m_rotationEditSlider, SLOT(setValue(QVector3D)));
+    connect(m_host, SIGNAL(scalingChanged(QVector3D)), m_scalingEdit, SLOT(setValue(QVector3D)));
+}
+
+void MeshProperty::hostDestroyed(QObject *) {
+    delete this;
+}
+
+void MeshProperty::meshTypeChanged(int meshType) {
+    if (meshType == Mesh::Triangle) {
+        m_meshTypeValueLabel->setText("Triangle");
+    } else if (meshType == Mesh::Line) {
+        m_meshTypeValueLabel->setText("Line");
+    } else {
+        m_meshTypeValueLabel->setText("Point");
+    }
+}
+
+void MeshProperty::vertexLayoutChanged(int options) {
+    // The loader may drop the tangent frame of a mesh, that choice isn't the user's
+    options &= ~VertexLayout::NoTangents;
+    int index = m_vertexLayoutComboBox->findData(options);
+    if (index < 0) {
+        m_vertexLayoutComboBox->addItem("Custom", options);
+        index = m_vertexLayoutComboBox->count() - 1;
+    }
+    m_vertexLayoutComboBox->setCurrentIndex(index);
+}
+
+void MeshProperty::vertexLayoutSelected(int index) {
+    int options = m_vertexLayoutComboBox->itemData(index).toInt();
+    m_host->setVertexLayout(options | (m_host->vertexLayout() & VertexLayout::NoTangents));
+}
+
+void MeshProperty::geometryChanged(const QVector<Vertex>&, const QVector<uint32_t>& indices) {
+    m_numOfVerticesValueLabel->setText(QString::number(m_host->vertexCount()));
+    if (m_host->meshType() == Mesh::Triangle && m_numOfFacesValueLabel)
+        m_numOfFacesValueLabel->setText(QString::number(indices.size() / 3));
+    if (m_numOfLodsValueLabel)
+        m_numOfLodsValueLabel->setText(QString::number(m_host->lodCount() - 1));
+    if (m_numOfMeshletsValueLabel)
+        m_numOfMeshletsValueLabel->setText(QString::number(m_host->meshlets().size()));
+}
+
+void MeshProperty::lodsChanged() {
+    if (m_numOfLodsValueLabel)
+        m_numOfLodsValueLabel->setText(QString::number(m_host->lodCount() - 1));
+}
+
+void MeshProperty::generateLods() {
+    MeshSimplifier::generateLods(m_host);
+}
+
+void MeshProperty::meshletsChanged() {
+    if (m_numOfMeshletsValueLabel)
+        m_numOfMeshletsValueLabel->setText(QString::number(m_host->meshlets().size()));
+}
+
+void MeshProperty::buildMeshlets() {
+    MeshOptimizer::buildMeshlets(m_host);
+}